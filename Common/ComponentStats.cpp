@@ -0,0 +1,10 @@
+#include "ComponentStats.h"
+
+CSV_DEFINE_CATEGORY(Components, true);
+
+LLM_DEFINE_TAG(Components);
+
+DEFINE_STAT(STAT_ActiveMovers);
+DEFINE_STAT(STAT_ValidTriggerActors);
+DEFINE_STAT(STAT_TriggerablesFannedOut);
+DEFINE_STAT(STAT_ContainerReallocations);
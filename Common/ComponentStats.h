@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/*
+	Shared stat group for the components in this project
+
+	Cycle counters are declared next to the code they measure with DECLARE_CYCLE_STAT(..., STATGROUP_Components).
+	- In game:		`stat Components`
+	- Insights:		scopes show up by name under the cpu channel
+	- Headless:		`-csvCaptureFrames=<N>` (or `csvprofile start/stop`) writes the Components csv category
+	- Memory:		`-llm` reports allocations made by the components under the Components tag
+*/
+DECLARE_STATS_GROUP(TEXT("Components"), STATGROUP_Components, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_EXTERN(Components);
+
+LLM_DECLARE_TAG(Components);
+
+/// @brief Movers that performed work this frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Movers"), STAT_ActiveMovers, STATGROUP_Components, );
+
+/// @brief Actors currently satisfying a trigger
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Valid Trigger Actors"), STAT_ValidTriggerActors, STATGROUP_Components, );
+
+/// @brief Triggerables triggered/reversed this frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Triggerables Fanned Out"), STAT_TriggerablesFannedOut, STATGROUP_Components, );
+
+/// @brief Times this frame a container wrapped with TRACK_COMPONENT_ALLOCATION changed its allocated size
+/// @remark Only the wrapped containers are counted, not every allocation the components make (use -llm for those)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Container Reallocations"), STAT_ContainerReallocations, STATGROUP_Components, );
+
+/// @brief Counts a reallocation when the container's allocated size changed from AllocatedSizeBefore
+#define TRACK_COMPONENT_ALLOCATION(Container, AllocatedSizeBefore) \
+	do \
+	{ \
+		if ((Container).GetAllocatedSize() != (AllocatedSizeBefore)) \
+		{ \
+			INC_DWORD_STAT(STAT_ContainerReallocations); \
+			CSV_CUSTOM_STAT(Components, ContainerReallocations, 1, ECsvCustomStatOp::Accumulate); \
+		} \
+	} \
+	while (0)
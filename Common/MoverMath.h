@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/*
+	Engine independent mover math
+
+	The hot kernels of UMover, UMoverPath, UTriggerableMover and UOrientSubsystem, written against plain vector and
+	quaternion types so they can be built, benchmarked and fuzzed without the engine. The components
+	convert with FromXYZ / ToXYZ and keep their engine types everywhere else.
+
+	Only the standard library may be included here.
+*/
+namespace MoverMath
+{
+	/// @brief Plain 3D vector. Rotations use X = Roll, Y = Pitch, Z = Yaw, matching FRotator::Euler.
+	struct FVec3
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+
+		FVec3 operator+(const FVec3& Other) const { return { X + Other.X, Y + Other.Y, Z + Other.Z }; }
+		FVec3 operator-(const FVec3& Other) const { return { X - Other.X, Y - Other.Y, Z - Other.Z }; }
+		FVec3 operator*(double Scale) const { return { X * Scale, Y * Scale, Z * Scale }; }
+
+		double SizeSquared() const { return X * X + Y * Y + Z * Z; }
+		double Size() const { return std::sqrt(SizeSquared()); }
+	};
+
+	/// @brief Plain quaternion
+	struct FQuat4
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+		double W = 1.0;
+
+		/// @brief Composes the rotations, applying Other first (same order as FQuat)
+		FQuat4 operator*(const FQuat4& Other) const
+		{
+			return {
+				W * Other.X + X * Other.W + Y * Other.Z - Z * Other.Y,
+				W * Other.Y - X * Other.Z + Y * Other.W + Z * Other.X,
+				W * Other.Z + X * Other.Y - Y * Other.X + Z * Other.W,
+				W * Other.W - X * Other.X - Y * Other.Y - Z * Other.Z };
+		}
+	};
+
+	constexpr double Pi = 3.1415926535897932;
+
+	/// @brief Converts any type with X, Y and Z members
+	template<typename T>
+	FVec3 FromXYZ(const T& Vector)
+	{
+		return { (double)Vector.X, (double)Vector.Y, (double)Vector.Z };
+	}
+
+	/// @brief Converts to any type constructible from X, Y and Z
+	template<typename T>
+	T ToXYZ(const FVec3& Vector)
+	{
+		return T(Vector.X, Vector.Y, Vector.Z);
+	}
+
+	/// @brief Quaternion from degrees, matching FRotator::Quaternion
+	inline FQuat4 QuatFromRotator(double Pitch, double Yaw, double Roll)
+	{
+		const double HalfRadians = Pi / 360.0;
+		const double SP = std::sin(Pitch * HalfRadians), CP = std::cos(Pitch * HalfRadians);
+		const double SY = std::sin(Yaw * HalfRadians), CY = std::cos(Yaw * HalfRadians);
+		const double SR = std::sin(Roll * HalfRadians), CR = std::cos(Roll * HalfRadians);
+
+		return {
+			CR * SP * SY - SR * CP * CY,
+			-CR * SP * CY - SR * CP * SY,
+			CR * CP * SY - SR * SP * CY,
+			CR * CP * CY + SR * SP * SY };
+	}
+
+	/// @brief Moves towards the target at a constant speed without overshooting (FMath::VInterpConstantTo)
+	/// @param Current Current location
+	/// @param Target Target location
+	/// @param DeltaTime Time step
+	/// @param Speed Distance per second
+	inline FVec3 InterpConstantTo(const FVec3& Current, const FVec3& Target, double DeltaTime, double Speed)
+	{
+		const FVec3 Delta = Target - Current;
+		const double Distance = Delta.Size();
+		const double MaxStep = Speed * DeltaTime;
+
+		if (Distance > MaxStep)
+		{
+			return MaxStep > 0.0 ? Current + Delta * (MaxStep / Distance) : Current;
+		}
+
+		return Target;
+	}
+
+	/// @brief Quaternion rotating by the angle (radians) about the unit axis (FQuat(Axis, Angle))
+	inline FQuat4 QuatFromAxisAngle(const FVec3& Axis, double Angle)
+	{
+		const double S = std::sin(Angle * 0.5);
+		return { Axis.X * S, Axis.Y * S, Axis.Z * S, std::cos(Angle * 0.5) };
+	}
+
+	/// @brief Rotation about a single axis. Angle counts whole turns rather than wrapping at 360 degrees.
+	struct FAxisAngle
+	{
+		FVec3 Axis = { 0.0, 0.0, 1.0 };
+		double Angle = 0.0;
+	};
+
+	/// @brief Bakes a stage rotation offset (degrees, may exceed 360) into a single axis and total angle
+	/// @remark The offset is split into equal steps of at most MaxStepDegrees on every axis, so each step has an
+	///	unambiguous direction, and the rotation is that step repeated. Offsets on a single axis turn exactly
+	///	that far, in the direction of their sign.
+	/// @param MaxStepDegrees Largest step on any axis, just under 180 so a step never takes the short way round
+	inline FAxisAngle BakeRotation(double Pitch, double Yaw, double Roll, double MaxStepDegrees = 179.9)
+	{
+		const double Largest = std::max({ std::abs(Pitch), std::abs(Yaw), std::abs(Roll) });
+		if (Largest <= 0.0)
+		{
+			return {};
+		}
+
+		const double Steps = std::ceil(Largest / MaxStepDegrees);
+		const FQuat4 Step = QuatFromRotator(Pitch / Steps, Yaw / Steps, Roll / Steps);
+
+		const double SinHalfAngle = std::sqrt(Step.X * Step.X + Step.Y * Step.Y + Step.Z * Step.Z);
+		if (SinHalfAngle <= 1e-12)
+		{
+			return {};
+		}
+
+		const double StepAngle = 2.0 * std::atan2(SinHalfAngle, Step.W);
+		return { { Step.X / SinHalfAngle, Step.Y / SinHalfAngle, Step.Z / SinHalfAngle }, StepAngle * Steps };
+	}
+
+	/// @brief Moves an angle towards the target by at most MaxStep without overshooting
+	inline double StepAngleTo(double Angle, double Target, double MaxStep)
+	{
+		return Target > Angle ? std::min(Angle + MaxStep, Target) : std::max(Angle - MaxStep, Target);
+	}
+
+	/// @brief Rotation facing along the direction with no roll (FRotationMatrix::MakeFromX)
+	/// @param bYawOnly Whether or not to stay upright, turning about the up axis only
+	inline FQuat4 FacingQuat(const FVec3& Direction, bool bYawOnly)
+	{
+		const double Yaw = std::atan2(Direction.Y, Direction.X) * (180.0 / Pi);
+		const double Pitch = bYawOnly ? 0.0 : std::atan2(Direction.Z, std::sqrt(Direction.X * Direction.X + Direction.Y * Direction.Y)) * (180.0 / Pi);
+		return QuatFromRotator(Pitch, Yaw, 0.0);
+	}
+
+	/// @brief Turns towards the target rotation by at most MaxAngle (radians) along the shortest arc
+	/// @param MaxAngle Largest turn, or negative for no limit
+	inline FQuat4 TurnTowards(const FQuat4& Current, FQuat4 Target, double MaxAngle)
+	{
+		double Dot = Current.X * Target.X + Current.Y * Target.Y + Current.Z * Target.Z + Current.W * Target.W;
+		if (Dot < 0.0)
+		{
+			Target = { -Target.X, -Target.Y, -Target.Z, -Target.W };
+			Dot = -Dot;
+		}
+
+		const double Angle = 2.0 * std::acos(std::min(Dot, 1.0));
+		if (MaxAngle < 0.0 || Angle <= MaxAngle)
+		{
+			return Target;
+		}
+
+		// Slerp by the fraction of the arc allowed this step
+		const double HalfAngle = Angle * 0.5;
+		const double SinHalfAngle = std::sin(HalfAngle);
+		const double Alpha = MaxAngle / Angle;
+		const double ScaleCurrent = std::sin((1.0 - Alpha) * HalfAngle) / SinHalfAngle;
+		const double ScaleTarget = std::sin(Alpha * HalfAngle) / SinHalfAngle;
+
+		return {
+			Current.X * ScaleCurrent + Target.X * ScaleTarget,
+			Current.Y * ScaleCurrent + Target.Y * ScaleTarget,
+			Current.Z * ScaleCurrent + Target.Z * ScaleTarget,
+			Current.W * ScaleCurrent + Target.W * ScaleTarget };
+	}
+
+	/// @brief Turns a batch of rotations to face their targets, in place
+	/// @remark Entries whose target coincides with their location keep their rotation
+	/// @param Locations Location of each entry
+	/// @param Targets Location each entry should face
+	/// @param MaxAngles Largest turn (radians) of each entry this step, or negative for no limit
+	/// @param YawOnly Whether or not each entry stays upright
+	/// @param Rotations Current rotation of each entry, replaced by the new rotation
+	/// @param Num Number of entries
+	inline void OrientTowards(const FVec3* Locations, const FVec3* Targets, const double* MaxAngles, const bool* YawOnly, FQuat4* Rotations, int32_t Num)
+	{
+		for (int32_t Index = 0; Index < Num; Index++)
+		{
+			FVec3 Direction = Targets[Index] - Locations[Index];
+			if (YawOnly[Index])
+			{
+				Direction.Z = 0.0;
+			}
+
+			if (Direction.SizeSquared() > 1e-8)
+			{
+				Rotations[Index] = TurnTowards(Rotations[Index], FacingQuat(Direction, YawOnly[Index]), MaxAngles[Index]);
+			}
+		}
+	}
+
+	/// @brief Moves the stage index one step in the direction, staying within the sequence
+	/// @param StageIndex Current stage
+	/// @param Direction 1 or -1
+	/// @param NumStages Stages in the sequence
+	inline int32_t AdvanceStage(int32_t StageIndex, int32_t Direction, int32_t NumStages)
+	{
+		return std::clamp(StageIndex + Direction, 0, std::max(NumStages - 1, 0));
+	}
+
+	/// @brief Whether or not finishing the stage completes the sequence in the direction of travel
+	/// @remark Stage 0 is the origin, so reversing completes once stage 1 has been travelled back
+	/// @param StageIndex Stage just finished
+	/// @param bReverse Whether or not the stage was travelled in reverse
+	/// @param NumStages Stages in the sequence
+	inline bool IsSequenceComplete(int32_t StageIndex, bool bReverse, int32_t NumStages)
+	{
+		return bReverse ? StageIndex <= 1 : StageIndex >= NumStages - 1;
+	}
+
+	/// @brief Folds time into a single pass of a path that stops at its end
+	inline double OnceTime(double Time, double Duration)
+	{
+		return std::clamp(Time, 0.0, Duration);
+	}
+
+	/// @brief Folds time into a single forward pass of a path travelled there and back
+	inline double PingPongTime(double Time, double Duration)
+	{
+		const double Cycle = std::fmod(std::max(Time, 0.0), Duration * 2.0);
+		return Cycle > Duration ? Duration * 2.0 - Cycle : Cycle;
+	}
+
+	/// @brief Folds time into a single pass of a repeating path
+	inline double LoopTime(double Time, double Duration)
+	{
+		return std::fmod(std::max(Time, 0.0), Duration);
+	}
+}
@@ -0,0 +1,120 @@
+#include "MoverSignificance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+namespace MoverSignificance
+{
+	static TAutoConsoleVariable<bool> CVarEnabled(
+		TEXT("mover.LOD.Enabled"),
+		true,
+		TEXT("Whether or not movers far from every player update at a reduced rate or freeze."));
+
+	static TAutoConsoleVariable<float> CVarFullDistance(
+		TEXT("mover.LOD.FullDistance"),
+		3000.0,
+		TEXT("Distance (cm) to the nearest player within which visible movers update every frame."));
+
+	static TAutoConsoleVariable<float> CVarFrozenDistance(
+		TEXT("mover.LOD.FrozenDistance"),
+		15000.0,
+		TEXT("Distance (cm) to the nearest player beyond which movers stop updating until they come back into range."));
+
+	static TAutoConsoleVariable<float> CVarReducedInterval(
+		TEXT("mover.LOD.ReducedInterval"),
+		0.25,
+		TEXT("Time (s) between updates of reduced rate movers."));
+
+	static TAutoConsoleVariable<float> CVarClassifyInterval(
+		TEXT("mover.LOD.ClassifyInterval"),
+		0.5,
+		TEXT("Time (s) between mover update tier classifications."));
+
+	static TAutoConsoleVariable<float> CVarCatchUpStep(
+		TEXT("mover.LOD.CatchUpStep"),
+		0.1,
+		TEXT("Longest single step (s) a mover catching up on skipped time is advanced by."));
+
+	/// @brief How recently an actor must have been rendered to count as visible
+	constexpr float VisibleTolerance = 0.5;
+
+	float GetClassifyInterval()
+	{
+		return CVarClassifyInterval.GetValueOnGameThread();
+	}
+
+	float GetReducedInterval()
+	{
+		return CVarReducedInterval.GetValueOnGameThread();
+	}
+
+	float GetCatchUpStep()
+	{
+		return FMath::Max(CVarCatchUpStep.GetValueOnGameThread(), KINDA_SMALL_NUMBER);
+	}
+
+	void GatherViewLocations(const UWorld* World, TArray<FVector>& OutViewLocations)
+	{
+		OutViewLocations.Reset();
+
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const APlayerController* PlayerController = It->Get())
+			{
+				FVector Location;
+				FRotator Rotation;
+				PlayerController->GetPlayerViewPoint(Location, Rotation);
+				OutViewLocations.Add(Location);
+			}
+		}
+	}
+
+	EMoverUpdateTier Classify(const AActor* Actor, TArrayView<const FVector> ViewLocations)
+	{
+		if (!CVarEnabled.GetValueOnGameThread() || ViewLocations.Num() == 0)
+		{
+			return EMoverUpdateTier::Full;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+		double NearestDistanceSquared = TNumericLimits<double>::Max();
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			NearestDistanceSquared = FMath::Min(NearestDistanceSquared, FVector::DistSquared(Location, ViewLocation));
+		}
+
+		if (NearestDistanceSquared >= FMath::Square(CVarFrozenDistance.GetValueOnGameThread()))
+		{
+			return EMoverUpdateTier::Frozen;
+		}
+
+		if (NearestDistanceSquared >= FMath::Square(CVarFullDistance.GetValueOnGameThread()))
+		{
+			return EMoverUpdateTier::Reduced;
+		}
+
+		// Nothing is rendered on a dedicated server, so only distance counts there
+		if (Actor->GetNetMode() == NM_DedicatedServer)
+		{
+			return EMoverUpdateTier::Full;
+		}
+
+		return Actor->WasRecentlyRendered(VisibleTolerance) ? EMoverUpdateTier::Full : EMoverUpdateTier::Reduced;
+	}
+}
+
+float FMoverSignificance::Consume(const float DeltaTime)
+{
+	PendingTime += DeltaTime;
+
+	if (Tier == EMoverUpdateTier::Frozen
+		|| (Tier == EMoverUpdateTier::Reduced && PendingTime < MoverSignificance::GetReducedInterval()))
+	{
+		return 0.0;
+	}
+
+	const float Time = PendingTime;
+	PendingTime = 0.0;
+	return Time;
+}
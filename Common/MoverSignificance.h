@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+
+/*
+	Distance and visibility based update tiers shared by the movers
+
+	Movers are classified against the view point of every player:
+		- Full:		within mover.LOD.FullDistance and recently rendered (or on a dedicated server)
+		- Reduced:	within mover.LOD.FrozenDistance, or nearby but off screen. Updated every mover.LOD.ReducedInterval seconds.
+		- Frozen:	beyond mover.LOD.FrozenDistance. Not updated at all.
+	Skipped time is owed to the mover and applied when it next updates, so it resumes at the right phase.
+*/
+
+/// @brief How often a mover is updated
+enum class EMoverUpdateTier : uint8
+{
+	Full,
+	Reduced,
+	Frozen
+};
+
+/// @brief Update tier of a mover and the time it is owed
+struct FMoverSignificance
+{
+	/// @brief Current update tier
+	EMoverUpdateTier Tier = EMoverUpdateTier::Full;
+
+	/// @brief Time elapsed but not yet applied to the mover
+	float PendingTime = 0.0;
+
+	/// @brief Adds the frame time and determines how much time to apply this frame
+	/// @param DeltaTime Time difference between frame changes
+	/// @return Time to apply now, or zero to skip the mover this frame
+	float Consume(const float DeltaTime);
+};
+
+namespace MoverSignificance
+{
+	/// @brief Time (s) between tier classifications
+	float GetClassifyInterval();
+
+	/// @brief Time (s) between updates of reduced rate movers
+	float GetReducedInterval();
+
+	/// @brief Longest single step (s) a mover catching up on skipped time is advanced by
+	float GetCatchUpStep();
+
+	/// @brief Gathers the view point of every player
+	/// @param World World to gather from
+	/// @param OutViewLocations Reset and filled with the view locations
+	void GatherViewLocations(const UWorld* World, TArray<FVector>& OutViewLocations);
+
+	/// @brief Classifies an actor into an update tier
+	/// @param Actor Actor being moved
+	/// @param ViewLocations Player view points. Empty means every mover updates at full rate.
+	/// @return The update tier
+	EMoverUpdateTier Classify(const AActor* Actor, TArrayView<const FVector> ViewLocations);
+}
@@ -0,0 +1,96 @@
+#include "MoverMath.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+	Times the MoverMath kernels over [Count = 100000] random entries, [Passes = 100] times each
+*/
+namespace
+{
+	/// @brief Accumulates results so the kernels are not optimized away
+	volatile double Sink = 0.0;
+
+	template<typename FunctionType>
+	void Time(const char* Name, int Count, int Passes, FunctionType&& Function)
+	{
+		const auto StartTime = std::chrono::steady_clock::now();
+		for (int Pass = 0; Pass < Passes; Pass++)
+		{
+			Function();
+		}
+		const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+		std::printf("%-18s %10.3fms %8.2fns/entry\n", Name, Seconds * 1000.0, Seconds * 1e9 / ((double)Count * Passes));
+	}
+}
+
+int main(int ArgCount, char** Args)
+{
+	using namespace MoverMath;
+
+	const int Count = ArgCount > 1 ? std::max(std::atoi(Args[1]), 1) : 100000;
+	const int Passes = ArgCount > 2 ? std::max(std::atoi(Args[2]), 1) : 100;
+
+	std::mt19937 Random(0);
+	std::uniform_real_distribution<double> Offset(-1000.0, 1000.0);
+	std::uniform_real_distribution<double> Degrees(-720.0, 720.0);
+
+	std::vector<FVec3> Locations(Count);
+	std::vector<FVec3> Targets(Count);
+	std::vector<double> Angles(Count);
+	std::vector<double> MaxAngles(Count);
+	std::unique_ptr<bool[]> YawOnly(new bool[Count]);
+	std::vector<FQuat4> Rotations(Count);
+
+	for (int Index = 0; Index < Count; Index++)
+	{
+		Locations[Index] = { Offset(Random), Offset(Random), Offset(Random) };
+		Targets[Index] = { Offset(Random), Offset(Random), Offset(Random) };
+		Angles[Index] = Degrees(Random);
+		MaxAngles[Index] = Index % 4 == 0 ? -1.0 : 0.05;
+		YawOnly[Index] = Index % 2 == 0;
+	}
+
+	Time("InterpConstantTo", Count, Passes, [&]()
+	{
+		double Sum = 0.0;
+		for (int Index = 0; Index < Count; Index++)
+		{
+			Sum += InterpConstantTo(Locations[Index], Targets[Index], 1.0 / 60.0, 300.0).X;
+		}
+		Sink = Sink + Sum;
+	});
+
+	Time("BakeRotation", Count, Passes, [&]()
+	{
+		double Sum = 0.0;
+		for (int Index = 0; Index < Count; Index++)
+		{
+			Sum += BakeRotation(Angles[Index], -Angles[Index] * 0.5, 0.0).Angle;
+		}
+		Sink = Sink + Sum;
+	});
+
+	Time("OrientTowards", Count, Passes, [&]()
+	{
+		OrientTowards(Locations.data(), Targets.data(), MaxAngles.data(), YawOnly.get(), Rotations.data(), Count);
+		Sink = Sink + Rotations[Count - 1].W;
+	});
+
+	Time("LoopTime", Count, Passes, [&]()
+	{
+		double Sum = 0.0;
+		for (int Index = 0; Index < Count; Index++)
+		{
+			Sum += LoopTime(Angles[Index] + 720.0, 3.0) + PingPongTime(Angles[Index] + 720.0, 3.0);
+		}
+		Sink = Sink + Sum;
+	});
+
+	return 0;
+}
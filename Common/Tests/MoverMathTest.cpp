@@ -0,0 +1,166 @@
+#include "MoverMath.h"
+
+#include <cstdio>
+
+/*
+	Checks of the MoverMath kernels against values worked out by hand. Returns non-zero if any check fails.
+*/
+namespace
+{
+	int Failures = 0;
+
+	void Check(bool bCondition, const char* Expression, int Line)
+	{
+		if (!bCondition)
+		{
+			std::printf("MoverMathTest.cpp(%d): check failed: %s\n", Line, Expression);
+			Failures++;
+		}
+	}
+
+	#define CHECK(Expression) Check((Expression), #Expression, __LINE__)
+
+	bool Near(double A, double B, double Tolerance = 1e-9)
+	{
+		return std::abs(A - B) <= Tolerance;
+	}
+
+	bool Near(const MoverMath::FVec3& A, const MoverMath::FVec3& B, double Tolerance = 1e-9)
+	{
+		return (A - B).Size() <= Tolerance;
+	}
+
+	/// @brief Angle (radians) between two rotations, treating Q and -Q as the same rotation
+	double AngleBetween(const MoverMath::FQuat4& A, const MoverMath::FQuat4& B)
+	{
+		const double Dot = std::abs(A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W);
+		return 2.0 * std::acos(std::min(Dot, 1.0));
+	}
+
+	void TestQuaternions()
+	{
+		using namespace MoverMath;
+
+		const FQuat4 Yaw90 = QuatFromRotator(0.0, 90.0, 0.0);
+		CHECK(Near(Yaw90.X, 0.0) && Near(Yaw90.Y, 0.0));
+		CHECK(Near(Yaw90.Z, std::sqrt(0.5)) && Near(Yaw90.W, std::sqrt(0.5)));
+
+		CHECK(Near(AngleBetween(Yaw90 * Yaw90, QuatFromRotator(0.0, 180.0, 0.0)), 0.0, 1e-7));
+		CHECK(Near(AngleBetween(QuatFromAxisAngle({ 0.0, 0.0, 1.0 }, Pi / 2.0), Yaw90), 0.0, 1e-7));
+	}
+
+	void TestInterpConstantTo()
+	{
+		using namespace MoverMath;
+
+		const FVec3 Start = { 0.0, 0.0, 0.0 };
+		const FVec3 Target = { 100.0, 0.0, 0.0 };
+
+		CHECK(Near(InterpConstantTo(Start, Target, 0.5, 50.0), FVec3{ 25.0, 0.0, 0.0 }));
+		CHECK(Near(InterpConstantTo(Start, Target, 10.0, 50.0), Target));
+		CHECK(Near(InterpConstantTo(Start, Target, 1.0, 0.0), Start));
+	}
+
+	void TestBakeRotation()
+	{
+		using namespace MoverMath;
+
+		// Whole turns are kept rather than wrapped away
+		const FAxisAngle TwoTurns = BakeRotation(0.0, 720.0, 0.0);
+		CHECK(Near(TwoTurns.Axis, FVec3{ 0.0, 0.0, 1.0 }, 1e-7));
+		CHECK(Near(TwoTurns.Angle, 4.0 * Pi, 1e-7));
+
+		// Negative offsets turn the other way rather than the long way round
+		const FAxisAngle Back = BakeRotation(0.0, -90.0, 0.0);
+		CHECK(Near(Back.Axis, FVec3{ 0.0, 0.0, -1.0 }, 1e-7));
+		CHECK(Near(Back.Angle, Pi / 2.0, 1e-7));
+
+		CHECK(BakeRotation(0.0, 0.0, 0.0).Angle == 0.0);
+
+		CHECK(StepAngleTo(0.0, 1.0, 0.25) == 0.25);
+		CHECK(StepAngleTo(0.0, 1.0, 2.0) == 1.0);
+		CHECK(StepAngleTo(1.0, -1.0, 0.5) == 0.5);
+	}
+
+	void TestOrientation()
+	{
+		using namespace MoverMath;
+
+		CHECK(Near(AngleBetween(FacingQuat({ 0.0, 1.0, 0.0 }, true), QuatFromRotator(0.0, 90.0, 0.0)), 0.0, 1e-7));
+		CHECK(Near(AngleBetween(FacingQuat({ 1.0, 0.0, 1.0 }, false), QuatFromRotator(45.0, 0.0, 0.0)), 0.0, 1e-7));
+		CHECK(Near(AngleBetween(FacingQuat({ 1.0, 0.0, 1.0 }, true), FQuat4()), 0.0, 1e-7));
+
+		const FQuat4 Identity;
+		const FQuat4 Yaw90 = QuatFromRotator(0.0, 90.0, 0.0);
+
+		// Limited turns stop short by exactly the limit, unlimited ones arrive
+		CHECK(Near(AngleBetween(TurnTowards(Identity, Yaw90, Pi / 8.0), Identity), Pi / 8.0, 1e-7));
+		CHECK(Near(AngleBetween(TurnTowards(Identity, Yaw90, -1.0), Yaw90), 0.0, 1e-7));
+
+		// The negated target is the same rotation and must not send the turn the long way round
+		const FQuat4 Negated = { -Yaw90.X, -Yaw90.Y, -Yaw90.Z, -Yaw90.W };
+		CHECK(Near(AngleBetween(TurnTowards(Identity, Negated, Pi / 8.0), Identity), Pi / 8.0, 1e-7));
+
+		const FVec3 Locations[2] = { { 0.0, 0.0, 0.0 }, { 10.0, 0.0, 0.0 } };
+		const FVec3 Targets[2] = { { 0.0, 100.0, 50.0 }, { 10.0, 0.0, 0.0 } };
+		const double MaxAngles[2] = { -1.0, -1.0 };
+		const bool YawOnly[2] = { true, true };
+		FQuat4 Rotations[2] = { Identity, Yaw90 };
+
+		OrientTowards(Locations, Targets, MaxAngles, YawOnly, Rotations, 2);
+		CHECK(Near(AngleBetween(Rotations[0], Yaw90), 0.0, 1e-7));
+
+		// A target on top of the entry leaves its rotation alone
+		CHECK(Near(AngleBetween(Rotations[1], Yaw90), 0.0, 1e-7));
+	}
+
+	void TestSequence()
+	{
+		using namespace MoverMath;
+
+		CHECK(AdvanceStage(0, 1, 3) == 1);
+		CHECK(AdvanceStage(2, 1, 3) == 2);
+		CHECK(AdvanceStage(0, -1, 3) == 0);
+		CHECK(AdvanceStage(0, 1, 0) == 0);
+
+		CHECK(IsSequenceComplete(2, false, 3));
+		CHECK(!IsSequenceComplete(1, false, 3));
+		CHECK(IsSequenceComplete(1, true, 3));
+		CHECK(!IsSequenceComplete(2, true, 3));
+	}
+
+	void TestPathTime()
+	{
+		using namespace MoverMath;
+
+		CHECK(OnceTime(3.0, 2.0) == 2.0);
+		CHECK(OnceTime(-1.0, 2.0) == 0.0);
+
+		CHECK(Near(PingPongTime(1.5, 2.0), 1.5));
+		CHECK(Near(PingPongTime(3.0, 2.0), 1.0));
+		CHECK(Near(PingPongTime(5.0, 2.0), 1.0));
+
+		CHECK(Near(LoopTime(5.0, 2.0), 1.0));
+		CHECK(Near(LoopTime(4.0, 2.0), 0.0));
+		CHECK(LoopTime(-1.0, 2.0) == 0.0);
+	}
+}
+
+int main()
+{
+	TestQuaternions();
+	TestInterpConstantTo();
+	TestBakeRotation();
+	TestOrientation();
+	TestSequence();
+	TestPathTime();
+
+	if (Failures > 0)
+	{
+		std::printf("%d MoverMath checks failed\n", Failures);
+		return 1;
+	}
+
+	std::printf("All MoverMath checks passed\n");
+	return 0;
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/// @brief Identifies a scheduled timer. Stale handles (expired or cancelled) are safely ignored.
+struct FTimerWheelHandle
+{
+	/// @brief Entry in the wheel's pool
+	int32 Index = INDEX_NONE;
+
+	/// @brief Generation of the entry when scheduled
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; }
+
+	bool operator==(const FTimerWheelHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+};
+
+/*
+	Hierarchical timer wheel
+
+	Timers are bucketed by expiry tick into NumLevels wheels of 64 slots. Level 0 holds timers due within
+	64 ticks, level 1 within 64^2 and so on; as the wheel turns, higher level slots cascade down. Scheduling
+	and cancelling are O(1), and each tick only visits the slot that comes due, so waiting timers cost nothing
+	until they expire. Entries live in a pooled array with intrusive links, so steady-state use does not allocate.
+*/
+template<typename ValueType, int32 NumLevels = 4>
+class TTimerWheel
+{
+public:
+	/// @param InResolution Length (s) of a tick. Timers expire on the first tick at or after their delay.
+	explicit TTimerWheel(float InResolution = 1.0 / 60.0)
+		: Resolution(InResolution)
+	{
+		for (int32& Head : Heads)
+		{
+			Head = INDEX_NONE;
+		}
+	}
+
+	/// @brief Schedules a value to expire after the delay
+	/// @param Delay Time (s) until expiry. Delays beyond the wheel's range are clamped to it.
+	/// @param Value Value handed back on expiry
+	FTimerWheelHandle Schedule(float Delay, const ValueType& Value)
+	{
+		int32 Index = FreeHead;
+		if (Index != INDEX_NONE)
+		{
+			FreeHead = Entries[Index].Next;
+		}
+		else
+		{
+			Index = Entries.AddDefaulted();
+		}
+
+		FEntry& Entry = Entries[Index];
+		Entry.Value = Value;
+		Entry.ExpireTick = CurrentTick + FMath::Clamp<uint64>(FMath::CeilToInt64(Delay / Resolution), 1, MaxTicks - 1);
+		Entry.bScheduled = true;
+		Link(Index);
+		NumScheduled++;
+
+		return { Index, Entry.Generation };
+	}
+
+	/// @brief Cancels a timer and invalidates the handle. Does nothing for stale handles.
+	void Cancel(FTimerWheelHandle& Handle)
+	{
+		if (IsScheduled(Handle))
+		{
+			Unlink(Handle.Index);
+			Free(Handle.Index);
+		}
+
+		Handle.Invalidate();
+	}
+
+	/// @brief Whether or not the handle refers to a timer that has not expired or been cancelled
+	bool IsScheduled(const FTimerWheelHandle& Handle) const
+	{
+		return Entries.IsValidIndex(Handle.Index) && Entries[Handle.Index].bScheduled && Entries[Handle.Index].Generation == Handle.Generation;
+	}
+
+	/// @brief Number of timers waiting to expire
+	int32 Num() const { return NumScheduled; }
+
+	/// @brief Time (s) the wheel has been turned by, including time not yet turned into ticks
+	/// @remark Timers expire up to a tick after their delay. Callers that need the exact expiry measure against this.
+	double GetTime() const { return Time; }
+
+	/// @brief Turns the wheel, calling OnExpired(Handle, Value) for every timer that came due
+	/// @remark Timers may be scheduled or cancelled from the callback. Expired handles are stale by the time it runs.
+	template<typename FunctorType>
+	void Advance(float DeltaTime, FunctorType&& OnExpired)
+	{
+		Time += DeltaTime;
+		Accumulator += DeltaTime;
+		const int64 Ticks = FMath::FloorToInt64(Accumulator / Resolution);
+		if (Ticks <= 0)
+		{
+			return;
+		}
+		Accumulator -= Ticks * Resolution;
+
+		for (int64 Tick = 0; Tick < Ticks; Tick++)
+		{
+			// Nothing can come due on an empty wheel, so skip straight to the end
+			if (NumScheduled == 0)
+			{
+				CurrentTick += Ticks - Tick;
+				break;
+			}
+
+			TickOnce();
+
+			// Hand the expired values out once the wheel is consistent again
+			for (int32 Expired = 0; Expired < ExpiredValues.Num(); Expired++)
+			{
+				OnExpired(ExpiredHandles[Expired], ExpiredValues[Expired]);
+			}
+			ExpiredValues.Reset();
+			ExpiredHandles.Reset();
+		}
+	}
+
+private:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr uint64 SlotMask = NumSlots - 1;
+	static constexpr uint64 MaxTicks = uint64(1) << (SlotBits * NumLevels);
+
+	struct FEntry
+	{
+		ValueType Value;
+		uint64 ExpireTick = 0;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Slot = INDEX_NONE;
+		uint32 Generation = 0;
+		bool bScheduled = false;
+	};
+
+	/// @brief Pooled entries. Free entries are chained through Next.
+	TArray<FEntry> Entries;
+
+	/// @brief First entry of each slot, level by level
+	int32 Heads[NumLevels * NumSlots];
+
+	/// @brief First free entry
+	int32 FreeHead = INDEX_NONE;
+
+	/// @brief Timers waiting to expire
+	int32 NumScheduled = 0;
+
+	/// @brief Length (s) of a tick
+	float Resolution;
+
+	/// @brief Time not yet turned into ticks
+	float Accumulator = 0.0;
+
+	/// @brief Total time turned by
+	double Time = 0.0;
+
+	/// @brief Ticks turned so far
+	uint64 CurrentTick = 0;
+
+	/// @brief Values expiring this tick, handed out once the wheel is consistent
+	TArray<ValueType> ExpiredValues;
+
+	/// @brief Handles of the values expiring this tick
+	TArray<FTimerWheelHandle> ExpiredHandles;
+
+	/// @brief Slot an entry belongs in for the current tick
+	int32 GetSlot(uint64 ExpireTick) const
+	{
+		const uint64 Delta = ExpireTick > CurrentTick ? ExpireTick - CurrentTick : 0;
+
+		int32 Level = 0;
+		while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+		{
+			Level++;
+		}
+
+		return Level * NumSlots + int32((ExpireTick >> (SlotBits * Level)) & SlotMask);
+	}
+
+	void Link(int32 Index)
+	{
+		FEntry& Entry = Entries[Index];
+		Entry.Slot = GetSlot(Entry.ExpireTick);
+		Entry.Prev = INDEX_NONE;
+		Entry.Next = Heads[Entry.Slot];
+
+		if (Entry.Next != INDEX_NONE)
+		{
+			Entries[Entry.Next].Prev = Index;
+		}
+		Heads[Entry.Slot] = Index;
+	}
+
+	void Unlink(int32 Index)
+	{
+		FEntry& Entry = Entries[Index];
+		if (Entry.Prev != INDEX_NONE)
+		{
+			Entries[Entry.Prev].Next = Entry.Next;
+		}
+		else
+		{
+			Heads[Entry.Slot] = Entry.Next;
+		}
+
+		if (Entry.Next != INDEX_NONE)
+		{
+			Entries[Entry.Next].Prev = Entry.Prev;
+		}
+	}
+
+	void Free(int32 Index)
+	{
+		FEntry& Entry = Entries[Index];
+		Entry.bScheduled = false;
+		Entry.Generation++;
+		Entry.Value = ValueType();
+		Entry.Next = FreeHead;
+		FreeHead = Index;
+		NumScheduled--;
+	}
+
+	/// @brief Moves every entry of a higher level slot down to where it now belongs
+	void Cascade(int32 Level)
+	{
+		const int32 Slot = Level * NumSlots + int32((CurrentTick >> (SlotBits * Level)) & SlotMask);
+
+		int32 Index = Heads[Slot];
+		Heads[Slot] = INDEX_NONE;
+		while (Index != INDEX_NONE)
+		{
+			const int32 Next = Entries[Index].Next;
+			Link(Index);
+			Index = Next;
+		}
+	}
+
+	void TickOnce()
+	{
+		CurrentTick++;
+
+		// Each time a level wraps, the next level's current slot comes within range of the one below
+		for (int32 Level = 1; Level < NumLevels && ((CurrentTick >> (SlotBits * (Level - 1))) & SlotMask) == 0; Level++)
+		{
+			Cascade(Level);
+		}
+
+		const int32 Slot = int32(CurrentTick & SlotMask);
+		int32 Index = Heads[Slot];
+		Heads[Slot] = INDEX_NONE;
+
+		while (Index != INDEX_NONE)
+		{
+			const int32 Next = Entries[Index].Next;
+			ExpiredValues.Add(MoveTemp(Entries[Index].Value));
+			ExpiredHandles.Add({ Index, Entries[Index].Generation });
+			Free(Index);
+			Index = Next;
+		}
+	}
+};
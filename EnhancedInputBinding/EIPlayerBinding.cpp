@@ -5,6 +5,8 @@
 AEIPlayerBinding::AEIPlayerBinding()
 {
 	PrimaryActorTick.bCanEverTick = true;
+
+	InputReplay = CreateDefaultSubobject<UInputReplayComponent>(TEXT("Input Replay"));
 }
 
 // Called when the game starts or when spawned
@@ -20,9 +22,9 @@ void AEIPlayerBinding::BeginPlay()
 		GetMesh()->HideBoneByName(WeaponBoneName, EPhysBodyOp::PBO_None);	
 	}
 
-	// Attach the component to the mesh and assign the gun owner
+	// Attach the component to the mesh and assign the gun owner (the gun traces from its owning pawn's view point)
 	Gun->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepRelativeTransform, WeaponSocketName);
-	Gun->SetOwner(GetOwner());
+	Gun->SetOwner(this);
 }
 
 // Called every frame
@@ -56,8 +58,8 @@ void AEIPlayerBinding::BindActions(UEnhancedInputComponent* PlayerEIComponent)
 	PlayerEIComponent->BindAction(InputLook, ETriggerEvent::Triggered, this, &AEIPlayerBinding::Look);
 
 	// Jump
-	PlayerEIComponent->BindAction(InputJump, ETriggerEvent::Triggered, this, &AEIPlayerBinding::Jump);
-	PlayerEIComponent->BindAction(InputJump, ETriggerEvent::Completed, this, &AEIPlayerBinding::Jump);
+	PlayerEIComponent->BindAction(InputJump, ETriggerEvent::Triggered, this, &AEIPlayerBinding::JumpStart);
+	PlayerEIComponent->BindAction(InputJump, ETriggerEvent::Completed, this, &AEIPlayerBinding::JumpStop);
 
 	// Crouch
 	PlayerEIComponent->BindAction(InputCrouch, ETriggerEvent::Triggered, this, &AEIPlayerBinding::CrouchStart);
@@ -65,7 +67,22 @@ void AEIPlayerBinding::BindActions(UEnhancedInputComponent* PlayerEIComponent)
 	PlayerEIComponent->BindAction(InputCrouch, ETriggerEvent::Canceled, this, &AEIPlayerBinding::CrouchStop);
 
 	// Weapons
-	PlayerEIComponent->BindAction(PrimaryFire, ETriggerEvent::Triggered, this, &AEIPlayerBinding::PrimaryFire);
+	PlayerEIComponent->BindAction(PrimaryFire, ETriggerEvent::Triggered, this, &AEIPlayerBinding::FirePrimary);
+	PlayerEIComponent->BindAction(PrimaryFire, ETriggerEvent::Completed, this, &AEIPlayerBinding::FirePrimaryStop);
+	PlayerEIComponent->BindAction(PrimaryFire, ETriggerEvent::Canceled, this, &AEIPlayerBinding::FirePrimaryStop);
+}
+
+const UInputAction* AEIPlayerBinding::GetInputAction(EReplayInputAction Action) const
+{
+	switch (Action)
+	{
+	case EReplayInputAction::Move:			return InputMove;
+	case EReplayInputAction::Look:			return InputLook;
+	case EReplayInputAction::Jump:			return InputJump;
+	case EReplayInputAction::Crouch:		return InputCrouch;
+	case EReplayInputAction::PrimaryFire:	return PrimaryFire;
+	default:								return nullptr;
+	}
 }
 
 void AEIPlayerBinding::Look(const FInputActionInstance& Instance)
@@ -97,12 +114,12 @@ void AEIPlayerBinding::CrouchStart(const FInputActionInstance& Instance)
 
 }
 
-void EIPlayerBinding::CrouchStop(const FInputActionInstance& Instance)
+void AEIPlayerBinding::CrouchStop(const FInputActionInstance& Instance)
 {
 
 }
 
-void EIPlayerBinding::PrimaryFire(const FInputActionInstance& Instance)
+void AEIPlayerBinding::FirePrimary(const FInputActionInstance& Instance)
 {
 	if (Gun)
 	{
@@ -110,3 +127,11 @@ void EIPlayerBinding::PrimaryFire(const FInputActionInstance& Instance)
 	}
 }
 
+void AEIPlayerBinding::FirePrimaryStop(const FInputActionInstance& Instance)
+{
+	if (Gun)
+	{
+		Gun->ReleaseTrigger();
+	}
+}
+
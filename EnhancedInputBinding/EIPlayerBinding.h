@@ -4,6 +4,7 @@
 #include "GameFramework/Character.h"
 #include "EnhancedInputSubsystems.h"
 #include "EnhancedInputComponent.h"
+#include "InputReplayComponent.h"
 #include "EIPlayerBinding.generated.h"
 
 class AGun;
@@ -57,6 +58,10 @@ public:
 	/// @brief Stored pointer to reference the weapon
 	AGun* Gun;
 
+	/// @brief Records/replays input for headless soak and performance runs (inactive without command line args)
+	UPROPERTY(VisibleAnywhere, Category="Input")
+	UInputReplayComponent* InputReplay;
+
 	// Sets default values for this character's properties
 	AEIPlayerBinding();
 
@@ -66,6 +71,11 @@ public:
 	// Called to bind functionality to input
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
+	/// @brief Retrieve the input action bound for the replay action
+	/// @param Action Replay action identifier
+	/// @return The bound input action or nullptr if not set
+	const UInputAction* GetInputAction(EReplayInputAction Action) const;
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -101,5 +111,9 @@ private:
 
 	/// @brief Trigger primary fire
 	/// @param Instance Action instance containing values
-	void PrimaryFire(const FInputActionInstance &Instance);
+	void FirePrimary(const FInputActionInstance &Instance);
+
+	/// @brief Release primary fire
+	/// @param Instance Action instance containing values
+	void FirePrimaryStop(const FInputActionInstance& Instance);
 };
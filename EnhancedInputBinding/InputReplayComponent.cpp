@@ -0,0 +1,363 @@
+#include "InputReplayComponent.h"
+#include "EIPlayerBinding.h"
+#include "EnhancedPlayerInput.h"
+#include "InputMappingContext.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace InputReplay
+{
+	/// @brief 'EIRP'
+	constexpr uint32 Magic = 0x45495250;
+	constexpr uint32 Version = 2;
+
+	/// @brief Serialized size of an FInputReplayEvent
+	constexpr int64 EventSize = sizeof(float) + sizeof(uint8) + sizeof(FVector3f);
+}
+
+// Sets default values for this component's properties
+UInputReplayComponent::UInputReplayComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// Input has been processed by the player controller by now
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+}
+
+// Called when the game starts
+void UInputReplayComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FString ReplayFileName;
+
+	if (FParse::Value(CommandLine, TEXT("InputReplay="), ReplayFileName))
+	{
+		if (!LoadRecording(ReplayFileName, Keys, Events) || Events.Num() == 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Unable to load input replay %s!"), *ReplayFileName);
+			return;
+		}
+
+		FParse::Value(CommandLine, TEXT("InputReplayDuration="), SoakDuration);
+		bExitWhenDone = FParse::Param(CommandLine, TEXT("InputReplayExit"));
+		bReplaying = true;
+
+		StartUsedPhysical = PeakUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+		NextMemorySample = MemorySampleInterval;
+	}
+	else if (FParse::Value(CommandLine, TEXT("InputRecord="), RecordFileName))
+	{
+		GatherKeys();
+		bRecording = true;
+	}
+
+	if (bReplaying || bRecording)
+	{
+		KeyValues.Init(FVector3f::ZeroVector, Keys.Num());
+		SetComponentTickEnabled(true);
+	}
+}
+
+// Called when the game ends
+void UInputReplayComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRecording && !SaveRecording(RecordFileName, Keys, Events))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Unable to save input recording %s!"), *RecordFileName);
+	}
+
+	if (bReplaying)
+	{
+		ReportReplay();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// Called every frame
+void UInputReplayComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	AEIPlayerBinding* Binding = GetPlayerBinding();
+	APlayerController* PlayerController = Binding ? Cast<APlayerController>(Binding->GetController()) : nullptr;
+
+	// Wait until the player has been possessed
+	if (PlayerController == nullptr)
+	{
+		return;
+	}
+
+	Elapsed += DeltaTime;
+
+	if (bRecording)
+	{
+		RecordFrame(Cast<UEnhancedPlayerInput>(PlayerController->PlayerInput));
+	}
+	else if (bReplaying)
+	{
+		TotalElapsed += DeltaTime;
+		TrackFrame(DeltaTime);
+		ReplayFrame(Cast<UEnhancedPlayerInput>(PlayerController->PlayerInput), DeltaTime);
+	}
+}
+
+AEIPlayerBinding* UInputReplayComponent::GetPlayerBinding() const
+{
+	return Cast<AEIPlayerBinding>(GetOwner());
+}
+
+void UInputReplayComponent::GatherKeys()
+{
+	AEIPlayerBinding* Binding = GetPlayerBinding();
+	if (Binding == nullptr || Binding->GroundMovementInputContext == nullptr)
+	{
+		return;
+	}
+
+	TSet<const UInputAction*> Actions;
+	for (uint8 ActionId = 0; ActionId < (uint8)EReplayInputAction::Count; ActionId++)
+	{
+		if (const UInputAction* Action = Binding->GetInputAction((EReplayInputAction)ActionId))
+		{
+			Actions.Add(Action);
+		}
+	}
+
+	// Events store the key index as a byte
+	for (const FEnhancedActionKeyMapping& Mapping : Binding->GroundMovementInputContext->GetMappings())
+	{
+		if (Keys.Num() < MAX_uint8 && Actions.Contains(Mapping.Action.Get()) && Mapping.Key.IsValid())
+		{
+			Keys.AddUnique(Mapping.Key);
+		}
+	}
+}
+
+void UInputReplayComponent::RecordFrame(UEnhancedPlayerInput* PlayerInput)
+{
+	if (PlayerInput == nullptr)
+	{
+		return;
+	}
+
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); KeyIndex++)
+	{
+		// Only changes are stored, held values are fed back every frame on replay
+		FVector3f Value = FVector3f(PlayerInput->GetRawVectorKeyValue(Keys[KeyIndex]));
+		if (Value != KeyValues[KeyIndex])
+		{
+			KeyValues[KeyIndex] = Value;
+			Events.Add({ (float)Elapsed, (uint8)KeyIndex, Value });
+		}
+	}
+}
+
+void UInputReplayComponent::ReplayFrame(UEnhancedPlayerInput* PlayerInput, const float DeltaTime)
+{
+	if (PlayerInput == nullptr)
+	{
+		return;
+	}
+
+	// Apply every event that is due this frame. Digital keys are pressed and released as they change.
+	while (EventIndex < Events.Num() && Events[EventIndex].Timestamp <= Elapsed)
+	{
+		const FInputReplayEvent& Event = Events[EventIndex++];
+		if (!Keys.IsValidIndex(Event.KeyIndex))
+		{
+			continue;
+		}
+
+		const FKey& Key = Keys[Event.KeyIndex];
+		const bool bWasDown = !KeyValues[Event.KeyIndex].IsZero();
+		KeyValues[Event.KeyIndex] = Event.Value;
+
+		if (Key.IsDigital() && bWasDown != !Event.Value.IsZero())
+		{
+			PlayerInput->InputKey(FInputKeyParams(Key, bWasDown ? IE_Released : IE_Pressed, FVector(Event.Value)));
+		}
+	}
+
+	// Axis input only lasts a single frame, so held axes are fed every frame
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); KeyIndex++)
+	{
+		if (!Keys[KeyIndex].IsDigital() && !KeyValues[KeyIndex].IsZero())
+		{
+			PlayerInput->InputKey(FInputKeyParams(Keys[KeyIndex], FVector(KeyValues[KeyIndex]), DeltaTime, 1));
+		}
+	}
+
+	if (EventIndex < Events.Num())
+	{
+		return;
+	}
+
+	// Loop the recording until the soak duration has been reached
+	if (TotalElapsed < SoakDuration)
+	{
+		EventIndex = 0;
+		Elapsed = 0.0;
+		return;
+	}
+
+	FinishReplay();
+}
+
+void UInputReplayComponent::TrackFrame(const float DeltaTime)
+{
+	const float FrameTime = DeltaTime * 1000.0;
+
+	int32 Bucket = 0;
+	while (Bucket < NumFrameTimeBuckets - 1 && FrameTime > FrameTimeBucketEdges[Bucket])
+	{
+		Bucket++;
+	}
+
+	FrameTimeHistogram[Bucket]++;
+	FrameCount++;
+	WorstFrameTime = FMath::Max(WorstFrameTime, FrameTime);
+
+	NextMemorySample -= DeltaTime;
+	if (NextMemorySample <= 0.0)
+	{
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+		NextMemorySample = MemorySampleInterval;
+	}
+}
+
+void UInputReplayComponent::FinishReplay()
+{
+	bReplaying = false;
+	SetComponentTickEnabled(false);
+
+	ReportReplay();
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void UInputReplayComponent::ReportReplay() const
+{
+	if (FrameCount == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Input replay finished: %llu frames over %.1fs, worst frame %.2fms"),
+		FrameCount, TotalElapsed, WorstFrameTime);
+
+	float LowerEdge = 0.0;
+	for (int32 Bucket = 0; Bucket < NumFrameTimeBuckets; Bucket++)
+	{
+		const double Percent = 100.0 * FrameTimeHistogram[Bucket] / FrameCount;
+		if (Bucket < NumFrameTimeBuckets - 1)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %6.1f - %6.1fms: %8u (%5.1f%%)"),
+				LowerEdge, FrameTimeBucketEdges[Bucket], FrameTimeHistogram[Bucket], Percent);
+			LowerEdge = FrameTimeBucketEdges[Bucket];
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %6.1fms +       : %8u (%5.1f%%)"),
+				LowerEdge, FrameTimeHistogram[Bucket], Percent);
+		}
+	}
+
+	const uint64 EndUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	UE_LOG(LogTemp, Display, TEXT("Input replay memory: start %.1fMB, end %.1fMB, peak %.1fMB, growth %.1fMB"),
+		StartUsedPhysical / (1024.0 * 1024.0),
+		EndUsedPhysical / (1024.0 * 1024.0),
+		FMath::Max(PeakUsedPhysical, EndUsedPhysical) / (1024.0 * 1024.0),
+		((int64)EndUsedPhysical - (int64)StartUsedPhysical) / (1024.0 * 1024.0));
+}
+
+bool UInputReplayComponent::LoadRecording(const FString& FileName, TArray<FKey>& OutKeys, TArray<FInputReplayEvent>& OutEvents)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FileName))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumKeys = 0;
+	Reader << Magic << Version << NumKeys;
+
+	if (Magic != InputReplay::Magic || Version != InputReplay::Version || NumKeys < 0 || NumKeys > MAX_uint8)
+	{
+		return false;
+	}
+
+	OutKeys.Reset(NumKeys);
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys && !Reader.IsError(); KeyIndex++)
+	{
+		FName KeyName;
+		Reader << KeyName;
+		OutKeys.Add(FKey(KeyName));
+	}
+
+	int32 NumEvents = 0;
+	Reader << NumEvents;
+	if (Reader.IsError() || NumEvents < 0)
+	{
+		return false;
+	}
+
+	// Reject counts the file cannot hold before allocating, so a truncated or corrupt file cannot ask for gigabytes
+	if (NumEvents * InputReplay::EventSize > Reader.TotalSize() - Reader.Tell())
+	{
+		return false;
+	}
+
+	OutEvents.SetNumUninitialized(NumEvents);
+	for (FInputReplayEvent& Event : OutEvents)
+	{
+		Reader << Event;
+		if (Event.KeyIndex >= NumKeys)
+		{
+			return false;
+		}
+	}
+
+	return !Reader.IsError();
+}
+
+bool UInputReplayComponent::SaveRecording(const FString& FileName, const TArray<FKey>& Keys, const TArray<FInputReplayEvent>& Events)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = InputReplay::Magic;
+	uint32 Version = InputReplay::Version;
+	int32 NumKeys = Keys.Num();
+	Writer << Magic << Version << NumKeys;
+
+	for (const FKey& Key : Keys)
+	{
+		FName KeyName = Key.GetFName();
+		Writer << KeyName;
+	}
+
+	int32 NumEvents = Events.Num();
+	Writer << NumEvents;
+
+	for (FInputReplayEvent Event : Events)
+	{
+		Writer << Event;
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *FileName);
+}
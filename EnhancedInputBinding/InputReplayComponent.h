@@ -0,0 +1,170 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputCoreTypes.h"
+#include "InputReplayComponent.generated.h"
+
+class AEIPlayerBinding;
+class UEnhancedPlayerInput;
+
+/// @brief Stable identifiers for the actions bound by AEIPlayerBinding. Keys mapped to these actions are recorded.
+UENUM()
+enum class EReplayInputAction : uint8
+{
+	Move,
+	Look,
+	Jump,
+	Crouch,
+	PrimaryFire,
+	Count UMETA(Hidden)
+};
+
+/// @brief Single recorded input change: the key's raw value from Timestamp onward
+struct FInputReplayEvent
+{
+	/// @brief Seconds since the recording started
+	float Timestamp = 0.0;
+
+	/// @brief Index into the recording's key table
+	uint8 KeyIndex = 0;
+
+	/// @brief Raw key value, before any modifiers. Digital keys are 0 or 1; 1D/2D axes only use the leading components
+	FVector3f Value = FVector3f::ZeroVector;
+
+	friend FArchive& operator<<(FArchive& Ar, FInputReplayEvent& Event)
+	{
+		return Ar << Event.Timestamp << Event.KeyIndex << Event.Value;
+	}
+};
+
+/*
+	Records and replays the Enhanced Input actions of an AEIPlayerBinding
+
+	Driven entirely from the command line so it can run headless (-nullrhi -nosound):
+		-InputRecord=<File>			Record action value changes to File
+		-InputReplay=<File>			Inject the recorded values back into the bound actions
+		-InputReplayDuration=<Sec>	Keep looping the replay until Sec seconds have passed (soak runs)
+		-InputReplayExit			Request exit once the replay finishes
+
+	Raw values of the keys mapped to the bound actions are recorded rather than the action values, and replayed
+	through the player input as key presses and axis movement. Replayed input therefore runs through the same
+	mapping and action modifiers (negate, dead zone, scale) and triggers as live input, which re-injecting the
+	already modified action values would apply a second time.
+
+	While replaying, frame times are gathered into a histogram and physical memory is sampled so
+	frame-time regressions and memory growth are reported at the end of the run.
+*/
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class SIMPLESHOOTER_API UInputReplayComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	// ctor
+	UInputReplayComponent();
+
+	// Called every frame
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/// @brief Loads a recording from disk
+	/// @param FileName Recording to load
+	/// @param OutKeys Keys the events refer to
+	/// @param OutEvents Events in timestamp order
+	/// @return Whether or not the file was a valid recording
+	static bool LoadRecording(const FString& FileName, TArray<FKey>& OutKeys, TArray<FInputReplayEvent>& OutEvents);
+
+	/// @brief Saves a recording to disk
+	/// @param FileName File to write
+	/// @param Keys Keys the events refer to
+	/// @param Events Events in timestamp order
+	/// @return Whether or not the file was written
+	static bool SaveRecording(const FString& FileName, const TArray<FKey>& Keys, const TArray<FInputReplayEvent>& Events);
+
+protected:
+	// Called when the game starts
+	virtual void BeginPlay() override;
+
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/// @brief Upper edges (ms) of the frame time histogram buckets. Anything above the last edge lands in the final bucket.
+	static constexpr float FrameTimeBucketEdges[] = { 8.0, 11.1, 16.7, 20.0, 25.0, 33.3, 50.0, 100.0 };
+	static constexpr int32 NumFrameTimeBuckets = UE_ARRAY_COUNT(FrameTimeBucketEdges) + 1;
+
+	/// @brief How often to sample physical memory while replaying
+	static constexpr double MemorySampleInterval = 5.0;
+
+	/// @brief Whether or not this component is recording input
+	bool bRecording = false;
+
+	/// @brief Whether or not this component is replaying input
+	bool bReplaying = false;
+
+	/// @brief Exit once the replay has finished
+	bool bExitWhenDone = false;
+
+	/// @brief File recorded input is written to
+	FString RecordFileName;
+
+	/// @brief Recorded or replayed keys, indexed by FInputReplayEvent::KeyIndex
+	TArray<FKey> Keys;
+
+	/// @brief Recorded or loaded events
+	TArray<FInputReplayEvent> Events;
+
+	/// @brief Next event to apply while replaying
+	int32 EventIndex = 0;
+
+	/// @brief Time since the recording/replay (or current replay loop) started
+	double Elapsed = 0.0;
+
+	/// @brief Total time spent replaying across all loops
+	double TotalElapsed = 0.0;
+
+	/// @brief Minimum replay time before finishing. Zero plays the recording once.
+	double SoakDuration = 0.0;
+
+	/// @brief Current raw value of every key
+	TArray<FVector3f> KeyValues;
+
+	/// @brief Number of frames landing in each frame time bucket
+	uint32 FrameTimeHistogram[NumFrameTimeBuckets] = {};
+
+	/// @brief Longest frame seen while replaying (ms)
+	float WorstFrameTime = 0.0;
+
+	/// @brief Total frames replayed
+	uint64 FrameCount = 0;
+
+	/// @brief Physical memory used when the replay started
+	uint64 StartUsedPhysical = 0;
+
+	/// @brief Highest physical memory usage seen while replaying
+	uint64 PeakUsedPhysical = 0;
+
+	/// @brief Time until the next memory sample
+	double NextMemorySample = 0.0;
+
+	/// @brief Owner the actions are read from/injected into
+	AEIPlayerBinding* GetPlayerBinding() const;
+
+	/// @brief Collects the keys mapped to the bound actions in the owner's mapping context
+	void GatherKeys();
+
+	/// @brief Records the raw value of every key, writing an event for those that changed
+	void RecordFrame(UEnhancedPlayerInput* PlayerInput);
+
+	/// @brief Applies due events, pressing/releasing digital keys as they change and feeding held axes for this frame
+	void ReplayFrame(UEnhancedPlayerInput* PlayerInput, const float DeltaTime);
+
+	/// @brief Adds the frame to the histogram and samples memory
+	void TrackFrame(const float DeltaTime);
+
+	/// @brief Ends the replay, logging the report and optionally requesting exit
+	void FinishReplay();
+
+	/// @brief Logs the frame time histogram and memory growth
+	void ReportReplay() const;
+};
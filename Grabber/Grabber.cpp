@@ -1,5 +1,43 @@
 #include "Grabber.h"
 #include "DrawDebugHelpers.h"
+#include "ComponentStats.h"
+#include "HAL/IConsoleManager.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+DECLARE_CYCLE_STAT(TEXT("Grabber Grab"), STAT_GrabberGrab, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Grabber Carry"), STAT_GrabberCarry, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Grabber Release"), STAT_GrabberRelease, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Grabber GetGrabbableInReach"), STAT_GrabberGetGrabbableInReach, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grabber Handle Updates"), STAT_GrabberHandleUpdates, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grabber Handle Updates Skipped"), STAT_GrabberHandleUpdatesSkipped, STATGROUP_Components);
+
+namespace Grabber
+{
+	static TAutoConsoleVariable<float> CVarCarryUpdateRate(
+		TEXT("grabber.CarryUpdateRate"),
+		0.0,
+		TEXT("Most physics handle updates (Hz) per carried object. 0 matches the physics substep rate, or every frame without substepping."));
+
+	/// @brief Rotation change (degrees) that counts as the holder turning
+	constexpr float CarryRotationTolerance = 0.01;
+
+	/// @brief Range the mass tuning may scale the handle's interpolation speed by
+	constexpr float MinInterpolationScale = 0.25;
+	constexpr float MaxInterpolationScale = 2.0;
+
+	/// @brief Shortest time (s) between physics handle updates
+	static float GetCarryInterval()
+	{
+		const float Rate = CVarCarryUpdateRate.GetValueOnGameThread();
+		if (Rate > 0.0)
+		{
+			return 1.0 / Rate;
+		}
+
+		const UPhysicsSettings* Settings = UPhysicsSettings::Get();
+		return Settings->bSubstepping ? Settings->MaxSubstepDeltaTime : 0.0;
+	}
+}
 
 
 // Sets default values for this component's properties
@@ -14,6 +52,11 @@ void UGrabber::BeginPlay()
 {
 	Super::BeginPlay();
 	PhysicsHandle = GetPhysicsHandle();
+
+	if (PhysicsHandle)
+	{
+		DefaultInterpolationSpeed = PhysicsHandle->InterpolationSpeed;
+	}
 }
 
 
@@ -24,12 +67,14 @@ void UGrabber::TickComponent(float DeltaTime, ELevelTick TickType, FActorCompone
 
 	if(PhysicsHandle && IsCarryingSomething)
 	{
-		Carry();
+		Carry(DeltaTime);
 	}	
 }
 
 void UGrabber::Grab()
 {
+	SCOPE_CYCLE_COUNTER(STAT_GrabberGrab);
+
 	if (PhysicsHandle == nullptr || IsCarryingSomething)
 	{
 		return;
@@ -41,12 +86,23 @@ void UGrabber::Grab()
 	if (HasHit)
 	{
 		UPrimitiveComponent *Component = Hit.GetComponent();
-		FRotator GrabberRotation = GetComponentRotation();
 
-		Component->WakeAllRigidBodies();
-		Component->SetSimulatePhysics(true);
+		// Only pay for the state changes that are needed, since objects are often re-grabbed straight after a throw.
+		// Starting to simulate wakes the body; a body already simulating only needs waking if it went to sleep.
+		if (!Component->IsSimulatingPhysics())
+		{
+			Component->SetSimulatePhysics(true);
+		}
+		else if (!Component->RigidBodyIsAwake())
+		{
+			Component->WakeAllRigidBodies();
+		}
+
 		AActor *GrabbedOwner = Component->GetOwner();
-		GrabbedOwner->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		if (GrabbedOwner->GetAttachParentActor())
+		{
+			GrabbedOwner->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		}
 		PhysicsHandle->GrabComponentAtLocationWithRotation(
 			Component,
 			NAME_None,
@@ -54,33 +110,151 @@ void UGrabber::Grab()
 			GetComponentRotation());
 
 		IsCarryingSomething = true;
+		TuneHandleForMass(Component);
+
+		// The first carry always updates the handle
+		CarryElapsed = Grabber::GetCarryInterval();
+		LastCarryLocation = GetCarryLocation();
+		LastHandleLocation = FVector(UE_BIG_NUMBER);
+		CarryHistoryNum = 0;
 
 		// Add the corresponding tag
 		ToggleGrabbedTag(GrabbedOwner, true);
 	}
 }
 
-void UGrabber::Carry()
+void UGrabber::Carry(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GrabberCarry);
+
+	if (PhysicsHandle->GetGrabbedComponent() == nullptr)
+	{
+		return;
+	}
+
+	const FVector CarryLocation = GetCarryLocation();
+	RecordCarryHistory(CarryLocation);
+
+	// Frames shorter than a physics substep would only overwrite a target physics has not consumed yet
+	const float Interval = Grabber::GetCarryInterval();
+	CarryElapsed += DeltaTime;
+	if (CarryElapsed < Interval)
+	{
+		return;
+	}
+
+	// Lead the target by the holder's velocity until the next update so the object does not trail behind
+	FVector TargetLocation = CarryLocation;
+	if (Interval > DeltaTime)
+	{
+		TargetLocation += (CarryLocation - LastCarryLocation) * (Interval / CarryElapsed);
+	}
+
+	LastCarryLocation = CarryLocation;
+	CarryElapsed = 0.0;
+
+	const FRotator TargetRotation = GetComponentRotation();
+	if (TargetLocation.Equals(LastHandleLocation, CarryTolerance) && TargetRotation.Equals(LastHandleRotation, Grabber::CarryRotationTolerance))
+	{
+		INC_DWORD_STAT(STAT_GrabberHandleUpdatesSkipped);
+		return;
+	}
+
+	LastHandleLocation = TargetLocation;
+	LastHandleRotation = TargetRotation;
+	PhysicsHandle->SetTargetLocationAndRotation(TargetLocation, TargetRotation);
+
+	INC_DWORD_STAT(STAT_GrabberHandleUpdates);
+	CSV_CUSTOM_STAT(Components, GrabberHandleUpdates, 1, ECsvCustomStatOp::Accumulate);
+}
+
+void UGrabber::TuneHandleForMass(UPrimitiveComponent* Component)
 {
-	UPrimitiveComponent *Component = PhysicsHandle->GetGrabbedComponent();
-	if (Component)
+	if (ReferenceMass <= 0.0)
 	{
-		FVector TargetLocation = GetComponentLocation() + GetForwardVector() * HoldDistance;
-		PhysicsHandle->SetTargetLocationAndRotation(TargetLocation, GetComponentRotation());
+		return;
 	}
+
+	// Square root keeps very heavy and very light objects within a usable range of the base speed
+	const float Mass = FMath::Max(Component->GetMass(), KINDA_SMALL_NUMBER);
+	const float Scale = FMath::Clamp(FMath::Sqrt(ReferenceMass / Mass), Grabber::MinInterpolationScale, Grabber::MaxInterpolationScale);
+	PhysicsHandle->SetInterpolationSpeed(DefaultInterpolationSpeed * Scale);
 }
 
 void UGrabber::Release()
 {
-	UPrimitiveComponent *GrabbedComponent = PhysicsHandle->GetGrabbedComponent();
-	if (GrabbedComponent && IsCarryingSomething)
+	ReleaseGrabbed(true);
+}
+
+void UGrabber::Throw()
+{
+	if (PhysicsHandle == nullptr)
+	{
+		return;
+	}
+
+	const FVector Velocity = GetCarryVelocity() + GetForwardVector() * ThrowSpeed;
+	if (UPrimitiveComponent* Component = ReleaseGrabbed(false))
+	{
+		// A single velocity write replaces the wake and impulse, and wakes the body itself
+		Component->SetPhysicsLinearVelocity(Velocity);
+	}
+}
+
+UPrimitiveComponent* UGrabber::ReleaseGrabbed(bool bWake)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GrabberRelease);
+
+	UPrimitiveComponent *GrabbedComponent = PhysicsHandle ? PhysicsHandle->GetGrabbedComponent() : nullptr;
+	if (GrabbedComponent == nullptr || !IsCarryingSomething)
+	{
+		return nullptr;
+	}
+
+	if (bWake)
 	{
 		GrabbedComponent->WakeAllRigidBodies();
-		PhysicsHandle->ReleaseComponent();
+	}
+
+	PhysicsHandle->ReleaseComponent();
+	PhysicsHandle->SetInterpolationSpeed(DefaultInterpolationSpeed);
+
+	ToggleGrabbedTag(GrabbedComponent->GetOwner(), false);
+	IsCarryingSomething = false;
+
+	return GrabbedComponent;
+}
+
+void UGrabber::RecordCarryHistory(const FVector& Location)
+{
+	CarryHistory[CarryHistoryHead] = Location;
+	CarryHistoryTimes[CarryHistoryHead] = GetWorld()->GetTimeSeconds();
+	CarryHistoryHead = (CarryHistoryHead + 1) % CarryHistorySize;
+	CarryHistoryNum = FMath::Min(CarryHistoryNum + 1, CarryHistorySize);
+}
+
+FVector UGrabber::GetCarryVelocity() const
+{
+	if (CarryHistoryNum < 2)
+	{
+		return FVector::ZeroVector;
+	}
 
-		ToggleGrabbedTag(GrabbedComponent->GetOwner(), false);
-		IsCarryingSomething = false;
+	// Walk back from the newest sample to the oldest one still inside the window
+	const int32 Newest = (CarryHistoryHead + CarryHistorySize - 1) % CarryHistorySize;
+	int32 Oldest = Newest;
+	for (int32 Age = 1; Age < CarryHistoryNum; Age++)
+	{
+		const int32 Sample = (Newest + CarryHistorySize - Age) % CarryHistorySize;
+		Oldest = Sample;
+		if (CarryHistoryTimes[Newest] - CarryHistoryTimes[Sample] >= ThrowVelocityWindow)
+		{
+			break;
+		}
 	}
+
+	const float Elapsed = CarryHistoryTimes[Newest] - CarryHistoryTimes[Oldest];
+	return Elapsed > 0.0 ? (CarryHistory[Newest] - CarryHistory[Oldest]) / Elapsed : FVector::ZeroVector;
 }
 
 void UGrabber::ToggleGrabbedTag(AActor *Actor, bool Add)
@@ -110,6 +284,8 @@ void UGrabber::ToggleGrabbedTag(AActor *Actor, bool Add)
 
 bool UGrabber::GetGrabbableInReach(FHitResult &OutHit) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_GrabberGetGrabbableInReach);
+
 	UWorld *World = GetWorld();
 	FVector Start = GetComponentLocation();
 	FVector End = Start + (GetForwardVector() * MaxGrabDistance);	
@@ -135,16 +311,4 @@ UPhysicsHandleComponent* UGrabber::GetPhysicsHandle() const
 	}
 
 	return Result;
-}
-
-void UGrabber::RotateActorToFaceAnotherActor(AActor* ActorToFace, AActor* SecondActor)
-{
-	FVector FaceForward = ActorToFace->GetActorForwardVector();
-	FRotator RelativeSecond = UKismetMathLibrary::InverseTransformRotation(
-		SecondActor->GetTransform(), 
-		SecondActor->GetActorRotation());
-	FVector SecondForward = UKismetMathLibrary::GetForwardVector(RelativeSecond);
-
-	FRotator LookAt = UKismetMathLibrary::FindLookAtRotation(FaceForward, SecondForward);
-	SecondActor->AddActorLocalRotation(LookAt);
 }
\ No newline at end of file
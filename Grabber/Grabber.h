@@ -4,7 +4,6 @@
 #include "Components/SceneComponent.h"
 #include "PhysicsEngine/PhysicsHandleComponent.h"
 #include "Engine/World.h"
-#include "Kismet/KismetMathLibrary.h"
 #include "Grabber.generated.h"
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
@@ -30,6 +29,23 @@ public:
 	UPROPERTY(EditAnywhere)
 	float HoldDistance = 100.0;
 
+	/// @brief Distance the carry target must move before the physics handle is updated
+	UPROPERTY(EditAnywhere)
+	float CarryTolerance = 0.1;
+
+	/// @brief Speed (cm/s) added along the grabber's forward vector when throwing
+	UPROPERTY(EditAnywhere)
+	float ThrowSpeed = 1000.0;
+
+	/// @brief Recent time (s) of carrying used to measure the holder's velocity for a throw
+	UPROPERTY(EditAnywhere)
+	float ThrowVelocityWindow = 0.1;
+
+	/// @brief Mass (kg) carried at the physics handle's own interpolation speed
+	/// @remark Heavier objects follow more slowly and lighter ones faster. Zero keeps the handle's speed for everything.
+	UPROPERTY(EditAnywhere)
+	float ReferenceMass = 50.0;
+
 	// ctor
 	UGrabber();
 
@@ -44,6 +60,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void Release();
 
+	/// @brief Release the actor with the velocity it was being carried at plus ThrowSpeed along the forward vector
+	UFUNCTION(BlueprintCallable)
+	void Throw();
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
@@ -56,8 +76,53 @@ private:
 	/// @brief Physics handle for 
 	UPhysicsHandleComponent* PhysicsHandle;
 
+	/// @brief Interpolation speed of the physics handle before it was tuned for the carried mass
+	float DefaultInterpolationSpeed = 0.0;
+
+	/// @brief Time since the physics handle was last updated
+	float CarryElapsed = 0.0;
+
+	/// @brief Carry target when the physics handle was last updated, before prediction
+	FVector LastCarryLocation = FVector::ZeroVector;
+
+	/// @brief Target last written to the physics handle
+	FVector LastHandleLocation = FVector::ZeroVector;
+
+	/// @brief Rotation last written to the physics handle
+	FRotator LastHandleRotation = FRotator::ZeroRotator;
+
+	/// @brief Carry locations sampled over the last frames, oldest overwritten first
+	static constexpr int32 CarryHistorySize = 8;
+	FVector CarryHistory[CarryHistorySize];
+	float CarryHistoryTimes[CarryHistorySize];
+
+	/// @brief Next sample to overwrite and number of valid samples
+	int32 CarryHistoryHead = 0;
+	int32 CarryHistoryNum = 0;
+
+	/// @brief Records a carry location for the throw velocity
+	void RecordCarryHistory(const FVector& Location);
+
+	/// @brief Velocity the carried object was moving at over the throw velocity window
+	FVector GetCarryVelocity() const;
+
+	/// @brief Releases the grabbed component and removes the grabbed tag
+	/// @param bWake Whether or not to wake the released bodies. A throw sets their velocity, which wakes them anyway.
+	/// @return The released component or nullptr if nothing was carried
+	UPrimitiveComponent* ReleaseGrabbed(bool bWake);
+
 	/// @brief Sets the grabbed actor's location while it is being carried
-	void Carry();
+	/// @remark Skips the physics handle when the target has not moved, and when frames are shorter than a
+	/// physics substep, updates it once per substep with the target predicted ahead to the next update
+	/// @param DeltaTime Time difference between frame changes
+	void Carry(float DeltaTime);
+
+	/// @brief Location the carried object is held at
+	FVector GetCarryLocation() const { return GetComponentLocation() + GetForwardVector() * HoldDistance; }
+
+	/// @brief Scales the physics handle's interpolation speed for the carried mass
+	/// @param Component Grabbed component
+	void TuneHandleForMass(UPrimitiveComponent* Component);
 
 	/// @brief Determines of the actor in the hit result is within reach and is detected on the trace channel
 	/// @param OutHit The hit result 
@@ -72,10 +137,4 @@ private:
 	/// @param Actor Actor to toggle the grabbed tag on
 	/// @param Add Add the tag if true or remove the tag if false
 	void ToggleGrabbedTag(AActor *Actor, bool Add);
-
-	/// @brief Rotates the an actor to face another actor based on retrieving forward vector from world rotation
-	/// @remark Does not currently work as intended... Though some results are hilarious...
-	/// @param ActorToFace Actor that the second actor should turn towards
-	/// @param SecondActor Actor performing the rotation to face the ActorToFace
-	void RotateActorToFaceAnotherActor(AActor* ActorToFace, AActor* SecondActor);
 };
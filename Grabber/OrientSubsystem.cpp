@@ -0,0 +1,111 @@
+#include "OrientSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "ComponentStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Orient Gather"), STAT_OrientGather, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Orient Kernel"), STAT_OrientKernel, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Orient Write Back"), STAT_OrientWriteBack, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Orient Actors"), STAT_OrientActors, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Orient Actors Turned"), STAT_OrientActorsTurned, STATGROUP_Components);
+
+void UOrientSubsystem::AddOrientation(AActor* Actor, AActor* Target, float MaxAngularSpeed, bool bYawOnly)
+{
+	if (Actor == nullptr || Target == nullptr || Actor == Target)
+	{
+		return;
+	}
+
+	FOrientEntry* Entry = Entries.FindByPredicate([Actor](const FOrientEntry& Other) { return Other.Actor == Actor; });
+	if (Entry == nullptr)
+	{
+		LLM_SCOPE_BYTAG(Components);
+		const SIZE_T AllocatedSize = Entries.GetAllocatedSize();
+		Entry = &Entries.AddDefaulted_GetRef();
+		TRACK_COMPONENT_ALLOCATION(Entries, AllocatedSize);
+	}
+
+	Entry->Actor = Actor;
+	Entry->Target = Target;
+	Entry->MaxAngularSpeed = MaxAngularSpeed > 0.0 ? FMath::DegreesToRadians(MaxAngularSpeed) : -1.0;
+	Entry->bYawOnly = bYawOnly;
+}
+
+void UOrientSubsystem::RemoveOrientation(AActor* Actor)
+{
+	Entries.RemoveAllSwap([Actor](const FOrientEntry& Entry) { return Entry.Actor == Actor; });
+}
+
+void UOrientSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	Gather(DeltaTime);
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_OrientKernel);
+		MoverMath::OrientTowards(Locations.GetData(), Targets.GetData(), MaxAngles.GetData(), YawOnly.GetData(), Rotations.GetData(), Rotations.Num());
+	}
+
+	WriteBack();
+}
+
+void UOrientSubsystem::Gather(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_OrientGather);
+
+	Entries.RemoveAllSwap([](const FOrientEntry& Entry) { return !Entry.Actor.IsValid() || !Entry.Target.IsValid(); });
+
+	const int32 Num = Entries.Num();
+	Locations.SetNumUninitialized(Num);
+	Targets.SetNumUninitialized(Num);
+	MaxAngles.SetNumUninitialized(Num);
+	YawOnly.SetNumUninitialized(Num);
+	Rotations.SetNumUninitialized(Num);
+
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		const FOrientEntry& Entry = Entries[Index];
+		const FQuat Rotation = Entry.Actor->GetActorQuat();
+
+		Locations[Index] = MoverMath::FromXYZ(Entry.Actor->GetActorLocation());
+		Targets[Index] = MoverMath::FromXYZ(Entry.Target->GetActorLocation());
+		MaxAngles[Index] = Entry.MaxAngularSpeed < 0.0 ? -1.0 : Entry.MaxAngularSpeed * DeltaTime;
+		YawOnly[Index] = Entry.bYawOnly;
+		Rotations[Index] = { Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+	}
+
+	SET_DWORD_STAT(STAT_OrientActors, Num);
+}
+
+void UOrientSubsystem::WriteBack()
+{
+	SCOPE_CYCLE_COUNTER(STAT_OrientWriteBack);
+
+	int32 Turned = 0;
+	for (int32 Index = 0; Index < Entries.Num(); Index++)
+	{
+		AActor* Actor = Entries[Index].Actor.Get();
+		const MoverMath::FQuat4& Rotation = Rotations[Index];
+		const FQuat NewRotation(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+
+		// Actors already facing their target are left alone so they do not dirty their transform
+		if (!Actor->GetActorQuat().Equals(NewRotation, UE_KINDA_SMALL_NUMBER))
+		{
+			Actor->SetActorRotation(NewRotation);
+			Turned++;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_OrientActorsTurned, Turned);
+	CSV_CUSTOM_STAT(Components, OrientActorsTurned, Turned, ECsvCustomStatOp::Set);
+}
+
+TStatId UOrientSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UOrientSubsystem, STATGROUP_Components);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MoverMath.h"
+#include "OrientSubsystem.generated.h"
+
+/*
+	Batched orient-to-target service
+
+	Actors registered with a target turn to face it every frame, e.g. carried shields or turrets tracking the
+	players. The frame is done in three passes so the math runs over packed arrays:
+		- gather:		locations and rotations of every actor and target
+		- kernel:		MoverMath::OrientTowards computes every facing rotation, limited by each entry's turn rate
+		- write back:	rotations that changed are applied, each actor moved once
+*/
+UCLASS()
+class CRYPTRAIDER_API UOrientSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// @brief Turns an actor to face a target every frame, replacing any target it already had
+	/// @param Actor Actor to turn
+	/// @param Target Actor to face
+	/// @param MaxAngularSpeed Largest turn rate (deg/s), or zero to snap to the target
+	/// @param bYawOnly Whether or not to stay upright, turning about the up axis only
+	UFUNCTION(BlueprintCallable, Category = "Orient")
+	void AddOrientation(AActor* Actor, AActor* Target, float MaxAngularSpeed = 0.0, bool bYawOnly = true);
+
+	/// @brief Stops turning an actor
+	UFUNCTION(BlueprintCallable, Category = "Orient")
+	void RemoveOrientation(AActor* Actor);
+
+	/// @brief Number of actors being turned
+	int32 GetNumOrientations() const { return Entries.Num(); }
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FOrientEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<AActor> Target;
+
+		/// @brief Largest turn rate (rad/s), or negative for no limit
+		double MaxAngularSpeed = -1.0;
+
+		bool bYawOnly = true;
+	};
+
+	/// @brief Registered actors and their targets
+	TArray<FOrientEntry> Entries;
+
+	/// @brief Packed kernel inputs and outputs, kept between frames so they do not reallocate
+	TArray<MoverMath::FVec3> Locations;
+	TArray<MoverMath::FVec3> Targets;
+	TArray<double> MaxAngles;
+	TArray<bool> YawOnly;
+	TArray<MoverMath::FQuat4> Rotations;
+
+	/// @brief Drops entries whose actor or target was destroyed, then packs the rest into the kernel arrays
+	void Gather(float DeltaTime);
+
+	/// @brief Applies the rotations that changed
+	void WriteBack();
+};
@@ -1,4 +1,7 @@
 #include "Mover.h"
+#include "MoverSubsystem.h"
+#include "MoverPath.h"
+#include "MoverMath.h"
 
 // Sets default values for this component's properties
 UMover::UMover()
@@ -12,6 +15,22 @@ void UMover::BeginPlay()
 {
 	Super::BeginPlay();
 	LocationOrigin = GetOwner()->GetActorLocation();
+
+	if (UMoverSubsystem* MoverSubsystem = GetWorld()->GetSubsystem<UMoverSubsystem>())
+	{
+		MoverSubsystem->RegisterMover(this);
+	}
+}
+
+// Called when the game ends
+void UMover::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMoverSubsystem* MoverSubsystem = GetWorld()->GetSubsystem<UMoverSubsystem>())
+	{
+		MoverSubsystem->UnregisterMover(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 
@@ -20,9 +39,49 @@ void UMover::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponent
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	TickMove(DeltaTime);
+}
+
+void UMover::TickMove(float DeltaTime)
+{
+	if (Path)
+	{
+		MoveAlongPath(DeltaTime);
+		return;
+	}
+
 	Move(GetOwner()->GetActorLocation(), DeltaTime);
 }
 
+void UMover::SetUpdateTier(EMoverUpdateTier Tier)
+{
+	if (Tier == UpdateTier)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Movement is derived from elapsed time, so a single step lands on the right phase
+	if (UpdateTier == EMoverUpdateTier::Frozen && !IsOneTimeMoveAndDone())
+	{
+		TickMove(Now - FrozenAtTime);
+	}
+
+	UpdateTier = Tier;
+
+	if (Tier == EMoverUpdateTier::Frozen)
+	{
+		FrozenAtTime = Now;
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	// Interval ticks receive the full time since the previous tick
+	SetComponentTickInterval(Tier == EMoverUpdateTier::Reduced ? MoverSignificance::GetReducedInterval() : 0.0f);
+	SetComponentTickEnabled(!IsOneTimeMoveAndDone());
+}
+
 bool UMover::IsOneTimeMover()
 {
 	return OneTimeMove;
@@ -57,10 +116,29 @@ void UMover::Move(FVector CurrentLocation, float DeltaTime)
 	float Speed = MoveOffset.Length() / MoveTime;
 
 	// Next location to move to in sequence
-	FVector NewLocation = FMath::VInterpConstantTo(CurrentLocation, TargetLocation, DeltaTime, Speed);
+	FVector NewLocation = MoverMath::ToXYZ<FVector>(MoverMath::InterpConstantTo(
+		MoverMath::FromXYZ(CurrentLocation), MoverMath::FromXYZ(TargetLocation), DeltaTime, Speed));
 	GetOwner()->SetActorLocation(NewLocation);
 
-	OneTimeMoveAndDone(CurrentLocation);
+	OneTimeMoveAndDone(NewLocation);
+}
+
+void UMover::MoveAlongPath(float DeltaTime)
+{
+	// Deactivating pauses the mover where it is on the path
+	if (!Activate || IsOneTimeMoveAndDone())
+	{
+		return;
+	}
+
+	PathElapsed += DeltaTime;
+	GetOwner()->SetActorLocation(LocationOrigin + Path->Evaluate(PathElapsed + PathTimeOffset));
+
+	if (OneTimeMove && Path->IsFinished(PathElapsed + PathTimeOffset))
+	{
+		HasCompletedMove = true;
+		CompleteOneTimeMove();
+	}
 }
 
 bool UMover::IsOneTimeMoveAndDone()
@@ -72,10 +150,20 @@ void UMover::OneTimeMoveAndDone(FVector CurrentLocation)
 {
 	if (!OneTimeMove){ return; }
 
-	HasCompletedMove = LocationOrigin + MoveOffset == CurrentLocation;
+	HasCompletedMove = FVector::PointsAreNear(LocationOrigin + MoveOffset, CurrentLocation, CompletionTolerance);
+	if (HasCompletedMove)
+	{
+		CompleteOneTimeMove();
+	}
+}
+
+void UMover::CompleteOneTimeMove()
+{
+	// Nothing left to move once a one shot is done
+	SetComponentTickEnabled(false);
 
 	// Only enable physics if the one shot mover is done
-	if (EnablePhysicsOnMove && IsOneTimeMoveAndDone())
+	if (EnablePhysicsOnMove)
 	{
 		UPrimitiveComponent *Component = Cast<UPrimitiveComponent>(GetOwner()->GetRootComponent());
 		if (Component == nullptr)
@@ -84,7 +172,10 @@ void UMover::OneTimeMoveAndDone(FVector CurrentLocation)
 			return;
 		}
 
-		Component->SetSimulatePhysics(true);
-		Component->RecreatePhysicsState();
+		// Activation is deferred and spread across frames so props finishing together do not hitch
+		if (UMoverSubsystem* MoverSubsystem = GetWorld()->GetSubsystem<UMoverSubsystem>())
+		{
+			MoverSubsystem->QueuePhysicsActivation(Component);
+		}
 	}
 }
\ No newline at end of file
@@ -3,8 +3,10 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Math/UnrealMathUtility.h"
+#include "MoverSignificance.h"
 #include "Mover.generated.h"
 
+class UMoverPath;
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class CRYPTRAIDER_API UMover : public UActorComponent
@@ -28,6 +30,18 @@ public:
 	UPROPERTY(EditAnywhere)
 	bool OneTimeMove = false;
 
+	/// @brief Optional shared waypoint path. When set, the mover follows it instead of MoveOffset.
+	UPROPERTY(EditAnywhere)
+	UMoverPath* Path = nullptr;
+
+	/// @brief Time (s) added to the elapsed path time so movers sharing a path can be staggered
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "Path != nullptr"))
+	float PathTimeOffset = 0.0;
+
+	/// @brief Distance from the move offset at which a one time move counts as completed
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0"))
+	float CompletionTolerance = 0.1;
+
 	// ctor
 	UMover();
 
@@ -43,6 +57,10 @@ public:
 	/// @param ShouldMove 
 	void SetActivation(bool ShouldMove);
 
+	/// @brief Changes how often the mover updates, applying the time spent frozen when it resumes
+	/// @param Tier Update tier chosen by UMoverSubsystem
+	void SetUpdateTier(EMoverUpdateTier Tier);
+
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -50,16 +68,30 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// @brief Advances the mover by the elapsed time
+	/// @param DeltaTime Time since the mover last updated
+	void TickMove(float DeltaTime);
+
 	/// @brief Moves the mover from its current location to the origin + offset
 	/// @param CurrentLocation Current Vector of the Mover Location
 	/// @param DeltaTime Time difference between frame changes
 	void Move(FVector CurrentLocation, float DeltaTime);
+
+	/// @brief Moves the mover along its path while active
+	/// @param DeltaTime Time difference between frame changes
+	void MoveAlongPath(float DeltaTime);
 	
-	/// @brief Sets the move completion for one time movers
-	/// @remarks Compares the Origin + Offset location with the current location.
+	/// @brief Sets the move completion for one time movers, queueing physics activation once done
+	/// @remarks Compares the Origin + Offset location with the current location within CompletionTolerance.
 	/// @param CurrentLocation Current Vector of the Mover Location
 	void OneTimeMoveAndDone(FVector CurrentLocation);
 
+	/// @brief Stops the completed one time mover and queues physics activation if enabled
+	void CompleteOneTimeMove();
+
 private:
 	/// @brief Whether or not the mover is currently active
 	bool Activate = false;
@@ -69,4 +101,13 @@ private:
 
 	/// @brief Where the mover started from
 	FVector LocationOrigin;
+
+	/// @brief Time spent active on the path
+	float PathElapsed = 0.0;
+
+	/// @brief Current update tier
+	EMoverUpdateTier UpdateTier = EMoverUpdateTier::Full;
+
+	/// @brief World time at which the mover was frozen
+	double FrozenAtTime = 0.0;
 };
@@ -0,0 +1,69 @@
+#include "MoverPath.h"
+#include "Algo/BinarySearch.h"
+#include "MoverMath.h"
+
+void UMoverPath::PostLoad()
+{
+	Super::PostLoad();
+	Bake();
+}
+
+#if WITH_EDITOR
+void UMoverPath::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Bake();
+}
+#endif
+
+void UMoverPath::Bake()
+{
+	Points.Reset(Offsets.Num() + 2);
+	Points.Add(FVector::ZeroVector);
+	Points.Append(Offsets);
+
+	if (Schedule == EMoverPathSchedule::Loop)
+	{
+		Points.Add(FVector::ZeroVector);
+	}
+
+	const int32 NumSegments = Points.Num() - 1;
+	SegmentEndTimes.Reset(NumSegments);
+	Duration = 0.0;
+
+	for (int32 Segment = 0; Segment < NumSegments; Segment++)
+	{
+		const float SegmentDuration = SegmentDurations.IsValidIndex(Segment) ? SegmentDurations[Segment] : DefaultSegmentDuration;
+		Duration += FMath::Max(SegmentDuration, KINDA_SMALL_NUMBER);
+		SegmentEndTimes.Add(Duration);
+	}
+}
+
+FVector UMoverPath::Evaluate(float Elapsed) const
+{
+	if (SegmentEndTimes.Num() == 0)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// Fold the elapsed time into a single forward pass over the points
+	float Time = 0.0;
+	switch (Schedule)
+	{
+	case EMoverPathSchedule::PingPong:
+		Time = MoverMath::PingPongTime(Elapsed, Duration);
+		break;
+	case EMoverPathSchedule::Loop:
+		Time = MoverMath::LoopTime(Elapsed, Duration);
+		break;
+	default:
+		Time = MoverMath::OnceTime(Elapsed, Duration);
+		break;
+	}
+
+	const int32 Segment = FMath::Min(Algo::UpperBound(SegmentEndTimes, Time), SegmentEndTimes.Num() - 1);
+	const float SegmentStart = Segment > 0 ? SegmentEndTimes[Segment - 1] : 0.0f;
+	const float Alpha = FMath::Clamp((Time - SegmentStart) / (SegmentEndTimes[Segment] - SegmentStart), 0.0f, 1.0f);
+
+	return FMath::Lerp(Points[Segment], Points[Segment + 1], Alpha);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MoverPath.generated.h"
+
+/// @brief How a mover path repeats once the last waypoint is reached
+UENUM(BlueprintType)
+enum class EMoverPathSchedule : uint8
+{
+	/// @brief Stop at the last waypoint
+	Once,
+	/// @brief Travel back through the waypoints to the origin, then repeat
+	PingPong,
+	/// @brief Travel from the last waypoint straight back to the origin, then repeat
+	Loop
+};
+
+/*
+	Shared waypoint path for UMover
+
+	Immutable at runtime and shared by every mover referencing it, so each mover only stores its
+	elapsed time. Waypoints are offsets from the mover's origin; the origin itself is the first point.
+*/
+UCLASS(BlueprintType)
+class CRYPTRAIDER_API UMoverPath : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/// @brief Waypoints to visit after the origin, as offsets from the origin
+	UPROPERTY(EditAnywhere, Category = "Path")
+	TArray<FVector> Offsets;
+
+	/// @brief Time taken for each segment, starting with origin -> first offset. Missing entries use DefaultSegmentDuration.
+	UPROPERTY(EditAnywhere, Category = "Path")
+	TArray<float> SegmentDurations;
+
+	/// @brief Time taken for segments without an entry in SegmentDurations
+	UPROPERTY(EditAnywhere, Category = "Path", meta = (ClampMin = "0.01"))
+	float DefaultSegmentDuration = 4.0;
+
+	/// @brief How the path repeats
+	UPROPERTY(EditAnywhere, Category = "Path")
+	EMoverPathSchedule Schedule = EMoverPathSchedule::PingPong;
+
+	/// @brief Offset from the origin at a point in time
+	/// @param Elapsed Time since the mover started on the path
+	FVector Evaluate(float Elapsed) const;
+
+	/// @brief Whether or not a mover on this path has stopped at the last waypoint
+	/// @param Elapsed Time since the mover started on the path
+	bool IsFinished(float Elapsed) const { return Schedule == EMoverPathSchedule::Once && Elapsed >= Duration; }
+
+	/// @brief Rebuilds the segment timings. Called on load and after editing.
+	void Bake();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/// @brief Origin followed by the offsets, plus the origin again for loops
+	TArray<FVector> Points;
+
+	/// @brief Time at which each segment ends, ascending
+	TArray<float> SegmentEndTimes;
+
+	/// @brief Time taken to travel the points once
+	float Duration = 0.0;
+};
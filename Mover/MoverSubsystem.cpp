@@ -0,0 +1,139 @@
+#include "MoverSubsystem.h"
+#include "Mover.h"
+#include "MoverSignificance.h"
+#include "Components/PrimitiveComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "ComponentStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Mover Classify"), STAT_MoverClassify, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Mover Physics Activation"), STAT_MoverPhysicsActivation, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mover Pending Physics Activations"), STAT_MoverPendingActivations, STATGROUP_Components);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Mover Physics Activation Max ms"), STAT_MoverActivationMaxMs, STATGROUP_Components);
+
+namespace MoverSubsystem
+{
+	static TAutoConsoleVariable<int32> CVarActivationsPerFrame(
+		TEXT("mover.PhysicsActivationsPerFrame"),
+		4,
+		TEXT("Most one time movers that enable physics in a single frame."));
+
+	static TAutoConsoleVariable<float> CVarActivationBudgetMs(
+		TEXT("mover.PhysicsActivationBudgetMs"),
+		1.0,
+		TEXT("Time budget (ms) per frame for enabling physics on one time movers. At least one activation always runs."));
+}
+
+void UMoverSubsystem::RegisterMover(UMover* Mover)
+{
+	Movers.AddUnique(Mover);
+}
+
+void UMoverSubsystem::UnregisterMover(UMover* Mover)
+{
+	Movers.RemoveSwap(Mover);
+}
+
+void UMoverSubsystem::ClassifyMovers()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MoverClassify);
+
+	MoverSignificance::GatherViewLocations(GetWorld(), ViewLocations);
+
+	for (UMover* Mover : Movers)
+	{
+		Mover->SetUpdateTier(MoverSignificance::Classify(Mover->GetOwner(), ViewLocations));
+	}
+}
+
+void UMoverSubsystem::QueuePhysicsActivation(UPrimitiveComponent* Component)
+{
+	LLM_SCOPE_BYTAG(Components);
+	const SIZE_T AllocatedSize = PendingActivations.GetAllocatedSize();
+	PendingActivations.Add(Component);
+	TRACK_COMPONENT_ALLOCATION(PendingActivations, AllocatedSize);
+}
+
+void UMoverSubsystem::ActivatePhysics(UPrimitiveComponent* Component)
+{
+	// Only rebuild the physics state if the body was never created, otherwise just switch it to simulating
+	if (!Component->GetBodyInstance() || !Component->GetBodyInstance()->IsValidBodyInstance())
+	{
+		Component->RecreatePhysicsState();
+	}
+
+	Component->SetSimulatePhysics(true);
+	Component->WakeRigidBody();
+}
+
+void UMoverSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ClassifyCountdown -= DeltaTime;
+	if (ClassifyCountdown <= 0.0)
+	{
+		ClassifyCountdown = MoverSignificance::GetClassifyInterval();
+		ClassifyMovers();
+	}
+
+	ActivatePendingPhysics();
+}
+
+void UMoverSubsystem::ActivatePendingPhysics()
+{
+	if (GetNumPendingActivations() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_MoverPhysicsActivation);
+
+	const int32 MaxActivations = FMath::Max(MoverSubsystem::CVarActivationsPerFrame.GetValueOnGameThread(), 1);
+	const double BudgetSeconds = MoverSubsystem::CVarActivationBudgetMs.GetValueOnGameThread() / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 Activations = 0;
+	while (NextActivation < PendingActivations.Num() && Activations < MaxActivations)
+	{
+		// Always make progress, even if a single activation is over budget
+		if (Activations > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+
+		if (UPrimitiveComponent* Component = PendingActivations[NextActivation].Get())
+		{
+			ActivatePhysics(Component);
+			Activations++;
+		}
+		NextActivation++;
+	}
+
+	if (NextActivation == PendingActivations.Num())
+	{
+		PendingActivations.Reset();
+		NextActivation = 0;
+	}
+
+	const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	MaxActivationFrameMs = FMath::Max(MaxActivationFrameMs, FrameMs);
+
+	SET_DWORD_STAT(STAT_MoverPendingActivations, GetNumPendingActivations());
+	SET_FLOAT_STAT(STAT_MoverActivationMaxMs, MaxActivationFrameMs);
+	CSV_CUSTOM_STAT(Components, MoverPhysicsActivationMs, FrameMs, ECsvCustomStatOp::Set);
+}
+
+void UMoverSubsystem::Deinitialize()
+{
+	if (MaxActivationFrameMs > 0.0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Mover physics activation peaked at %.3fms in a single frame"), MaxActivationFrameMs);
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UMoverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMoverSubsystem, STATGROUP_Components);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MoverSubsystem.generated.h"
+
+class UPrimitiveComponent;
+class UMover;
+
+/*
+	Deferred physics activation for movers
+
+	One time movers that enable physics when done queue their root primitive here instead of switching
+	it to simulating immediately. Queued primitives are activated first come first served, spread across
+	frames by a per-frame count and time budget so many props finishing together do not hitch.
+		- mover.PhysicsActivationsPerFrame:	most activations per frame
+		- mover.PhysicsActivationBudgetMs:	time budget per frame; at least one activation always runs
+
+	Registered movers are also classified into update tiers by distance to and visibility from the players
+	(see MoverSignificance.h). Reduced movers tick at an interval; frozen movers stop ticking and apply the
+	time spent frozen when they resume.
+*/
+UCLASS()
+class CRYPTRAIDER_API UMoverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// @brief Register a mover for update tier classification
+	void RegisterMover(UMover* Mover);
+
+	/// @brief Unregister a mover
+	void UnregisterMover(UMover* Mover);
+
+	/// @brief Queues a primitive to start simulating physics on a later frame
+	/// @param Component Primitive to activate
+	void QueuePhysicsActivation(UPrimitiveComponent* Component);
+
+	/// @brief Number of primitives waiting to be activated
+	int32 GetNumPendingActivations() const { return PendingActivations.Num() - NextActivation; }
+
+	/// @brief Most time (ms) a single frame has spent activating physics
+	double GetMaxActivationFrameMs() const { return MaxActivationFrameMs; }
+
+	virtual void Deinitialize() override;
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/// @brief Registered movers
+	TArray<UMover*> Movers;
+
+	/// @brief Time until the movers are next classified into update tiers
+	float ClassifyCountdown = 0.0;
+
+	/// @brief Player view points used to classify the movers
+	TArray<FVector> ViewLocations;
+
+	/// @brief Classifies every mover into an update tier
+	void ClassifyMovers();
+
+	/// @brief Activates queued primitives within the frame budget
+	void ActivatePendingPhysics();
+
+	/// @brief Primitives waiting to be activated, in queue order
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> PendingActivations;
+
+	/// @brief Index of the next primitive to activate. The array is compacted once drained.
+	int32 NextActivation = 0;
+
+	/// @brief Most time (ms) a single frame has spent activating physics
+	double MaxActivationFrameMs = 0.0;
+
+	/// @brief Switches a primitive to simulating, reusing its physics state when it has one
+	/// @param Component Primitive to activate
+	static void ActivatePhysics(UPrimitiveComponent* Component);
+};
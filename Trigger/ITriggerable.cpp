@@ -1 +1,19 @@
-#include "ITriggerable.h"
\ No newline at end of file
+#include "ITriggerable.h"
+
+FTriggerableTarget::FTriggerableTarget(UObject* InObject)
+	: Object(InObject)
+	, Interface(Cast<IITriggerable>(InObject))
+{
+	if (Interface)
+	{
+		bNativeTrigger = IsNativeImplementation(Object, GET_FUNCTION_NAME_CHECKED(IITriggerable, Trigger));
+		bNativeReverse = IsNativeImplementation(Object, GET_FUNCTION_NAME_CHECKED(IITriggerable, Reverse));
+	}
+}
+
+bool FTriggerableTarget::IsNativeImplementation(const UObject* InObject, FName FunctionName)
+{
+	// A Blueprint override is owned by the Blueprint generated class
+	const UFunction* Function = InObject->FindFunction(FunctionName);
+	return Function == nullptr || Function->GetOwnerClass()->HasAnyClassFlags(CLASS_Native);
+}
@@ -53,3 +53,64 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Triggerable")
 	bool IsDone() const;
 };
+
+/*
+	Dispatch handle for a triggerable
+
+	Calling a BlueprintNativeEvent through Execute_ looks the function up and goes through ProcessEvent.
+	When the implementation is native C++ (no Blueprint override), the handle calls the virtual
+	_Implementation directly instead. Blueprint implementers and overrides keep the reflection path.
+*/
+struct MPSTARTER_API FTriggerableTarget
+{
+	FTriggerableTarget() = default;
+
+	/// @brief Resolves the dispatch path of each event for the object
+	/// @param InObject Object implementing UITriggerable, natively or in Blueprint
+	explicit FTriggerableTarget(UObject* InObject);
+
+	/// @brief Object implementing the triggerable
+	UObject* Object = nullptr;
+
+	/// @brief Native interface of the object, null for Blueprint-only implementers
+	IITriggerable* Interface = nullptr;
+
+	/// @brief Whether or not Trigger is implemented natively
+	bool bNativeTrigger = false;
+
+	/// @brief Whether or not Reverse is implemented natively
+	bool bNativeReverse = false;
+
+	/// @brief Triggers the triggerable through the fastest available path
+	void Trigger() const
+	{
+		if (bNativeTrigger)
+		{
+			Interface->Trigger_Implementation();
+		}
+		else
+		{
+			IITriggerable::Execute_Trigger(Object);
+		}
+	}
+
+	/// @brief Reverses the triggerable through the fastest available path
+	void Reverse() const
+	{
+		if (bNativeReverse)
+		{
+			Interface->Reverse_Implementation();
+		}
+		else
+		{
+			IITriggerable::Execute_Reverse(Object);
+		}
+	}
+
+	bool operator==(const FTriggerableTarget& Other) const { return Object == Other.Object; }
+
+	/// @brief Whether or not the object's implementation of the event is native (not overridden in Blueprint)
+	/// @param InObject Object implementing UITriggerable
+	/// @param FunctionName Event name
+	static bool IsNativeImplementation(const UObject* InObject, FName FunctionName);
+};
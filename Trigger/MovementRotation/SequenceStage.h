@@ -32,6 +32,11 @@ struct FSequenceStage
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable | Movement")
 	FStageRotation Rotation;
 
+	/// @brief Time (s) to wait at the end of this stage before moving on. The mover sleeps while it waits.
+	/// @remark Reversing waits at the start of the stage instead, using the hold of the stage before it
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable", meta = (ClampMin = "0", Units = "s"))
+	float HoldTime = 0.0;
+
 	UPROPERTY()
 	UObject *SafeObjectPointer;
 };
\ No newline at end of file
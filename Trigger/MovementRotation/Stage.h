@@ -1,8 +1,10 @@
 #pragma once
 
+#include "StageEasing.h"
 #include "Stage.generated.h"
 
 class UObject;
+class UCurveFloat;
 
 USTRUCT(BlueprintType)
 struct FStage
@@ -32,6 +34,33 @@ struct FStage
 	float ReverseVelocity = 1.0;
 #pragma endregion
 
+#pragma region Easing
+	/// @brief Velocity profile used over the stage
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable | Stage")
+	EStageEasing Easing = EStageEasing::Linear;
+
+	/// @brief Normalized position over normalized time ([0, 1] -> [0, 1]) used by the Curve profile
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable | Stage", meta = (EditCondition = "Easing == EStageEasing::Curve"))
+	UCurveFloat* EasingCurve = nullptr;
+
+	/// @brief Baked Curve profile. Built by BakeEasing.
+	FStageEasingTable EasingTable;
+#pragma endregion
+
 	UPROPERTY()
 	UObject *SafeObjectPointer;
-};
\ No newline at end of file
+
+public:
+	/// @brief Bakes the easing curve into its lookup table
+	void BakeEasing()
+	{
+		EasingTable.Build(Easing == EStageEasing::Curve ? EasingCurve : nullptr);
+	}
+
+	/// @brief Speed multiplier of the easing profile
+	/// @param Alpha Normalized stage time
+	float EvaluateEasing(float Alpha) const
+	{
+		return EvaluateStageEasing(Easing, Alpha, EasingTable);
+	}
+};
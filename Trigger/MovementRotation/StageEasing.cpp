@@ -0,0 +1,44 @@
+#include "StageEasing.h"
+#include "Curves/CurveFloat.h"
+
+void FStageEasingTable::Build(const UCurveFloat* Curve)
+{
+	Velocities.Reset();
+
+	if (Curve == nullptr)
+	{
+		return;
+	}
+
+	const float Start = Curve->GetFloatValue(0.0);
+	const float Range = Curve->GetFloatValue(1.0) - Start;
+	if (FMath::IsNearlyZero(Range))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Easing curve %s does not travel between 0 and 1! Using linear easing."), *Curve->GetName());
+		return;
+	}
+
+	// Central differences of the normalized curve, one-sided at the ends
+	const float Step = 1.0 / (NumSamples - 1);
+	Velocities.SetNumUninitialized(NumSamples);
+	for (int32 Index = 0; Index < NumSamples; Index++)
+	{
+		const float Low = FMath::Max(Index - 1, 0) * Step;
+		const float High = FMath::Min(Index + 1, NumSamples - 1) * Step;
+		Velocities[Index] = (Curve->GetFloatValue(High) - Curve->GetFloatValue(Low)) / (Range * (High - Low));
+	}
+}
+
+float EvaluateStageEasing(EStageEasing Easing, float Alpha, const FStageEasingTable& Table)
+{
+	switch (Easing)
+	{
+	case EStageEasing::SmoothStep:	return EvaluateStageEasing<EStageEasing::SmoothStep>(Alpha, Table);
+	case EStageEasing::EaseIn:		return EvaluateStageEasing<EStageEasing::EaseIn>(Alpha, Table);
+	case EStageEasing::EaseOut:		return EvaluateStageEasing<EStageEasing::EaseOut>(Alpha, Table);
+	case EStageEasing::EaseInOut:	return EvaluateStageEasing<EStageEasing::EaseInOut>(Alpha, Table);
+	case EStageEasing::Spring:		return EvaluateStageEasing<EStageEasing::Spring>(Alpha, Table);
+	case EStageEasing::Curve:		return EvaluateStageEasing<EStageEasing::Curve>(Alpha, Table);
+	default:						return EvaluateStageEasing<EStageEasing::Linear>(Alpha, Table);
+	}
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StageEasing.generated.h"
+
+class UCurveFloat;
+
+/// @brief Velocity profile used to travel a stage
+UENUM(BlueprintType)
+enum class EStageEasing : uint8
+{
+	/// @brief Constant speed
+	Linear,
+	/// @brief Accelerate and decelerate (3t^2 - 2t^3)
+	SmoothStep,
+	/// @brief Accelerate from rest
+	EaseIn,
+	/// @brief Decelerate to rest
+	EaseOut,
+	/// @brief Gentler acceleration and deceleration (6t^5 - 15t^4 + 10t^3)
+	EaseInOut,
+	/// @brief Critically damped spring; fast start settling into the target
+	Spring,
+	/// @brief Designer curve baked into a lookup table
+	Curve,
+	Count UMETA(Hidden)
+};
+
+/*
+	Baked velocity table for a designer easing curve
+
+	The curve is read as normalized position over normalized time ([0, 1] -> [0, 1]) and stored as
+	its derivative so it can be used as a speed multiplier like the built-in profiles.
+*/
+struct MPSTARTER_API FStageEasingTable
+{
+	/// @brief Bakes the curve. A null curve empties the table, which evaluates as linear.
+	/// @param Curve Curve to bake
+	void Build(const UCurveFloat* Curve);
+
+	/// @brief Speed multiplier at the normalized time
+	/// @param Alpha Normalized stage time
+	float Evaluate(float Alpha) const
+	{
+		if (Velocities.Num() < 2)
+		{
+			return 1.0;
+		}
+
+		const float Scaled = FMath::Clamp(Alpha, 0.0f, 1.0f) * (Velocities.Num() - 1);
+		const int32 Index = FMath::Min((int32)Scaled, Velocities.Num() - 2);
+		return FMath::Lerp(Velocities[Index], Velocities[Index + 1], Scaled - Index);
+	}
+
+private:
+	/// @brief Number of velocity samples to bake
+	static constexpr int32 NumSamples = 33;
+
+	/// @brief Baked speed multipliers, evenly spaced over normalized time
+	TArray<float> Velocities;
+};
+
+/// @brief Compile-time velocity profile evaluator. Returns a speed multiplier whose integral over [0, 1] is one.
+template<EStageEasing Easing>
+struct TStageEasing;
+
+template<>
+struct TStageEasing<EStageEasing::Linear>
+{
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table) { return 1.0; }
+};
+
+template<>
+struct TStageEasing<EStageEasing::SmoothStep>
+{
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table) { return 6.0 * Alpha * (1.0 - Alpha); }
+};
+
+template<>
+struct TStageEasing<EStageEasing::EaseIn>
+{
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table) { return 2.0 * Alpha; }
+};
+
+template<>
+struct TStageEasing<EStageEasing::EaseOut>
+{
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table) { return 2.0 * (1.0 - Alpha); }
+};
+
+template<>
+struct TStageEasing<EStageEasing::EaseInOut>
+{
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table)
+	{
+		const float Inverse = 1.0 - Alpha;
+		return 30.0 * Alpha * Alpha * Inverse * Inverse;
+	}
+};
+
+template<>
+struct TStageEasing<EStageEasing::Spring>
+{
+	/// @brief Spring stiffness; higher settles sooner
+	static constexpr float Stiffness = 8.0;
+
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table)
+	{
+		// Derivative of 1 - (1 + kt)e^-kt, normalized so the spring has settled at t = 1
+		const float Normalize = 1.0 - (1.0 + Stiffness) * FMath::Exp(-Stiffness);
+		return Stiffness * Stiffness * Alpha * FMath::Exp(-Stiffness * Alpha) / Normalize;
+	}
+};
+
+template<>
+struct TStageEasing<EStageEasing::Curve>
+{
+	static FORCEINLINE float Velocity(float Alpha, const FStageEasingTable& Table) { return Table.Evaluate(Alpha); }
+};
+
+/// @brief Speed multiplier for the profile. Profiles finish at full speed once the stage runs past its duration.
+/// @param Alpha Normalized stage time
+template<EStageEasing Easing>
+FORCEINLINE float EvaluateStageEasing(float Alpha, const FStageEasingTable& Table)
+{
+	return Alpha >= 1.0 ? 1.0 : TStageEasing<Easing>::Velocity(FMath::Max(Alpha, 0.0f), Table);
+}
+
+/// @brief Runtime dispatch to the specialized evaluators for when the profile is not known up front
+/// @param Easing Profile to evaluate
+/// @param Alpha Normalized stage time
+/// @param Table Baked table for curve profiles
+MPSTARTER_API float EvaluateStageEasing(EStageEasing Easing, float Alpha, const FStageEasingTable& Table);
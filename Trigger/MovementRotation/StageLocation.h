@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Stage.h"
+#include "StagePath.h"
 #include "StageLocation.generated.h"
 
 class UObject;
@@ -22,5 +23,33 @@ struct FStageLocation : public FStage
 	/// @brief Offset for shifting the actor
 	FVector Offset = FVector::Zero();
 
+	/// @brief Shape of the path travelled to reach the offset
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable | Stage")
+	EStagePathType PathType = EStagePathType::Linear;
+
+	/// @brief Control points of a curved path, relative to where the stage starts
+	/// @remark Bezier uses the first two points; Spline passes through every point
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable | Stage", meta = (EditCondition = "PathType != EStagePathType::Linear"))
+	TArray<FVector> ControlPoints;
+
+	/// @brief Number of evenly spaced points in the curved path's lookup table
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Triggerable | Stage", meta = (ClampMin = "2", EditCondition = "PathType != EStagePathType::Linear"))
+	int32 PathResolution = 64;
+
+	/// @brief Arc-length lookup table for curved paths. Built by BakePath.
+	FStagePathTable PathTable;
 #pragma endregion
-};
\ No newline at end of file
+
+public:
+	/// @brief Whether or not this stage travels along a curved path
+	bool IsCurved() const { return PathTable.IsValid(); }
+
+	/// @brief Distance travelled along the stage
+	double GetPathLength() const { return IsCurved() ? PathTable.Length : Offset.Size(); }
+
+	/// @brief Builds the arc-length lookup table for curved paths
+	void BakePath()
+	{
+		PathTable.Build(PathType, Offset, ControlPoints, PathResolution);
+	}
+};
@@ -0,0 +1,124 @@
+#include "StagePath.h"
+
+namespace StagePath
+{
+	/// @brief How many curve evaluations to take per stored point when measuring arc length
+	constexpr int32 OversampleFactor = 8;
+
+	FVector EvaluateBezier(const FVector& Offset, const TArray<FVector>& ControlPoints, double T)
+	{
+		const double U = 1.0 - T;
+
+		if (ControlPoints.Num() == 0)
+		{
+			return Offset * T;
+		}
+
+		if (ControlPoints.Num() == 1)
+		{
+			return ControlPoints[0] * (2.0 * U * T) + Offset * (T * T);
+		}
+
+		return ControlPoints[0] * (3.0 * U * U * T) + ControlPoints[1] * (3.0 * U * T * T) + Offset * (T * T * T);
+	}
+
+	FVector EvaluateSpline(const FVector& Offset, const TArray<FVector>& ControlPoints, double T)
+	{
+		// Knots are the start (zero), every control point, and the offset
+		const int32 NumSegments = ControlPoints.Num() + 1;
+		auto Knot = [&](int32 Index) -> FVector
+		{
+			Index = FMath::Clamp(Index, 0, NumSegments);
+			return Index == 0 ? FVector::ZeroVector : (Index == NumSegments ? Offset : ControlPoints[Index - 1]);
+		};
+
+		const double Scaled = FMath::Clamp(T, 0.0, 1.0) * NumSegments;
+		const int32 Segment = FMath::Min((int32)Scaled, NumSegments - 1);
+		const double U = Scaled - Segment;
+
+		const FVector P0 = Knot(Segment - 1);
+		const FVector P1 = Knot(Segment);
+		const FVector P2 = Knot(Segment + 1);
+		const FVector P3 = Knot(Segment + 2);
+
+		return 0.5 * ((2.0 * P1)
+			+ (P2 - P0) * U
+			+ (2.0 * P0 - 5.0 * P1 + 4.0 * P2 - P3) * (U * U)
+			+ (3.0 * P1 - P0 - 3.0 * P2 + P3) * (U * U * U));
+	}
+}
+
+void FStagePathTable::Build(EStagePathType PathType, const FVector& Offset, const TArray<FVector>& ControlPoints, int32 NumPoints)
+{
+	Points.Reset();
+	Length = 0.0;
+	Spacing = 0.0;
+
+	if (PathType == EStagePathType::Linear || NumPoints < 2)
+	{
+		return;
+	}
+
+	auto Evaluate = [&](double T)
+	{
+		return PathType == EStagePathType::Bezier
+			? StagePath::EvaluateBezier(Offset, ControlPoints, T)
+			: StagePath::EvaluateSpline(Offset, ControlPoints, T);
+	};
+
+	// Measure the cumulative arc length at evenly spaced parameters
+	const int32 NumSamples = NumPoints * StagePath::OversampleFactor;
+	TArray<FVector> Samples;
+	TArray<double> Distances;
+	Samples.SetNumUninitialized(NumSamples + 1);
+	Distances.SetNumUninitialized(NumSamples + 1);
+
+	Samples[0] = Evaluate(0.0);
+	Distances[0] = 0.0;
+	for (int32 Index = 1; Index <= NumSamples; Index++)
+	{
+		Samples[Index] = Evaluate((double)Index / NumSamples);
+		Distances[Index] = Distances[Index - 1] + FVector::Dist(Samples[Index - 1], Samples[Index]);
+	}
+
+	Length = Distances.Last();
+	if (Length <= UE_KINDA_SMALL_NUMBER)
+	{
+		Length = 0.0;
+		return;
+	}
+
+	// Invert the table so stored points are evenly spaced by distance instead of parameter
+	Spacing = Length / (NumPoints - 1);
+	Points.SetNumUninitialized(NumPoints);
+
+	int32 Sample = 0;
+	for (int32 Index = 0; Index < NumPoints; Index++)
+	{
+		const double Target = Index * Spacing;
+		while (Sample < NumSamples - 1 && Distances[Sample + 1] < Target)
+		{
+			Sample++;
+		}
+
+		const double SegmentLength = Distances[Sample + 1] - Distances[Sample];
+		const double Alpha = SegmentLength > 0.0 ? FMath::Clamp((Target - Distances[Sample]) / SegmentLength, 0.0, 1.0) : 0.0;
+		Points[Index] = FMath::Lerp(Samples[Sample], Samples[Sample + 1], Alpha);
+	}
+
+	// Guarantee the path ends exactly on the offset
+	Points.Last() = Offset;
+}
+
+FVector FStagePathTable::Sample(double Distance) const
+{
+	if (!IsValid())
+	{
+		return FVector::ZeroVector;
+	}
+
+	const double Scaled = FMath::Clamp(Distance, 0.0, Length) / Spacing;
+	const int32 Index = FMath::Min((int32)Scaled, Points.Num() - 2);
+
+	return FMath::Lerp(Points[Index], Points[Index + 1], Scaled - Index);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StagePath.generated.h"
+
+/// @brief Shape of the path a location stage travels along
+UENUM(BlueprintType)
+enum class EStagePathType : uint8
+{
+	/// @brief Straight line to the offset
+	Linear,
+	/// @brief Bezier curve to the offset using up to two control points
+	Bezier,
+	/// @brief Catmull-Rom spline through every control point and then the offset
+	Spline
+};
+
+/*
+	Arc-length parameterized lookup table for a curved stage path
+
+	Points are spaced evenly by distance along the curve, so constant speed travel is an index
+	and a lerp between two neighbouring points. Built once when the stage is added to a sequence.
+*/
+struct MPSTARTER_API FStagePathTable
+{
+	/// @brief Builds the table for the supplied path
+	/// @param PathType Shape of the path; Linear empties the table
+	/// @param Offset End of the path relative to its start
+	/// @param ControlPoints Control points relative to the start of the path
+	/// @param NumPoints Number of evenly spaced points to store
+	void Build(EStagePathType PathType, const FVector& Offset, const TArray<FVector>& ControlPoints, int32 NumPoints);
+
+	/// @brief Samples the path at the given distance from its start
+	/// @param Distance Distance along the path, clamped to [0, Length]
+	/// @return Position relative to the start of the path
+	FVector Sample(double Distance) const;
+
+	/// @brief Whether or not the table has been built for a curved path
+	bool IsValid() const { return Points.Num() > 1; }
+
+	/// @brief Total arc length of the path
+	double Length = 0.0;
+
+private:
+	/// @brief Points evenly spaced by arc length, relative to the start of the path
+	TArray<FVector> Points;
+
+	/// @brief Arc length between two neighbouring points
+	double Spacing = 0.0;
+};
@@ -1 +1,11 @@
 #include "StageRotation.h"
+#include "MoverMath.h"
+
+void FStageRotation::BakeRotation()
+{
+	const MoverMath::FAxisAngle AxisAngle = MoverMath::BakeRotation(PitchOffset, YawOffset, RollOffset);
+
+	BakedAxis = MoverMath::ToXYZ<FVector>(AxisAngle.Axis);
+	BakedAngle = AxisAngle.Angle;
+	BakedQuat = FQuat(BakedAxis, BakedAngle);
+}
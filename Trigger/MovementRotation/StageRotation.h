@@ -15,6 +15,11 @@ struct FStageRotation : public FStage
 	FStageRotation(FVector StageOffset, float StageForwardVelocity, bool bStageIsReversible = false, float StageReverseVelocity = 1.0) : Super(StageForwardVelocity, bStageIsReversible, StageReverseVelocity)
 	{
 		Offset = StageOffset;
+
+		// Offset is Roll, Pitch, Yaw; the individual offsets are what gets baked
+		RollOffset = StageOffset.X;
+		PitchOffset = StageOffset.Y;
+		YawOffset = StageOffset.Z;
 	};
 
 	FStageRotation(double Pitch, double Yaw, double Roll, float StageForwardVelocity = 1.0, bool bStageIsReversible = false, float StageReverseVelocity = 1.0) : Super(StageForwardVelocity, bStageIsReversible, StageReverseVelocity)
@@ -43,7 +48,21 @@ struct FStageRotation : public FStage
 	float RollOffset = 0.0;
 #pragma endregion
 
+#pragma region Baked
+	/// @brief Axis (component space) the stage rotates about. Built by BakeRotation.
+	FVector BakedAxis = FVector::UpVector;
+
+	/// @brief Total angle (radians) rotated about BakedAxis, counting whole turns. Built by BakeRotation.
+	double BakedAngle = 0.0;
+
+	/// @brief Rotation over the whole stage. Built by BakeRotation.
+	FQuat BakedQuat = FQuat::Identity;
+#pragma endregion
+
 public:
+	/// @brief Bakes the offsets into an axis and total angle so the mover never converts through Euler angles at runtime
+	void BakeRotation();
+
 	FVector ToVector()
 	{
 		Offset = FVector(RollOffset, PitchOffset, YawOffset);
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MoverEvents.generated.h"
+
+class UTriggerableMover;
+
+/// @brief Lifecycle events raised by UTriggerableMover
+UENUM(BlueprintType)
+enum class EMoverEvent : uint8
+{
+	Activated,
+	Deactivated,
+	Triggered,
+	Reversed,
+	Looped,
+	StageUpdated,
+	Completed
+};
+
+/// @brief Queued mover event, delivered at the end of the frame
+struct FMoverEvent
+{
+	/// @brief Mover raising the event
+	TWeakObjectPtr<UTriggerableMover> Mover;
+
+	/// @brief Event raised
+	EMoverEvent Event;
+
+	/// @brief Stage the mover was on when the event was raised
+	int32 StageIndex;
+};
+
+/// @brief Native listener receiving every mover event raised in the world during a frame
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMoverEvents, TArrayView<const FMoverEvent>);
+
+/// @brief Blueprint listener for a single mover's events
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTriggerableMoverEvent, EMoverEvent, Event, int32, StageIndex);
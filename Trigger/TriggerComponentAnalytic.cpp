@@ -0,0 +1,134 @@
+#include "TriggerComponentAnalytic.h"
+#include "TriggerSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+
+UTriggerComponentAnalytic::UTriggerComponentAnalytic() : UTriggerComponentBase()
+{
+	// Containment is evaluated by the trigger subsystem
+	PrimaryComponentTick.bCanEverTick = false;
+
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetGenerateOverlapEvents(false);
+}
+
+void UTriggerComponentAnalytic::InitializeTrigger()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	Super::InitializeTrigger();
+
+	if (bUsePhysicsOverlap)
+	{
+		CreatePhysicsShapes();
+	}
+	else if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+	{
+		TriggerSubsystem->RegisterAnalyticTrigger(this);
+	}
+}
+
+void UTriggerComponentAnalytic::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+	{
+		TriggerSubsystem->UnregisterAnalyticTrigger(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTriggerComponentAnalytic::UpdateAnalyticOverlaps(TArrayView<AActor* const> Candidates, TArrayView<const FVector> Locations)
+{
+	const FBox Bounds = GetTriggerBounds();
+
+	// Candidates that ended play were removed through RemoveAnalyticOverlap; anything else gone is only dropped
+	AnalyticOverlaps.RemoveAllSwap([](const TWeakObjectPtr<AActor>& Overlap) { return !Overlap.IsValid(); });
+
+	for (int32 Index = 0; Index < Candidates.Num(); Index++)
+	{
+		AActor* Actor = Candidates[Index];
+		const bool bInside = Bounds.IsInside(Locations[Index]) && ContainsPoint(Locations[Index]);
+		const int32 OverlapIndex = AnalyticOverlaps.Find(Actor);
+
+		if (bInside && OverlapIndex == INDEX_NONE)
+		{
+			AnalyticOverlaps.Add(Actor);
+			OverlapTriggerBegin(this, Actor, nullptr, INDEX_NONE, false, FHitResult());
+		}
+		else if (!bInside && OverlapIndex != INDEX_NONE)
+		{
+			AnalyticOverlaps.RemoveAtSwap(OverlapIndex);
+			OverlapTriggerEnd(this, Actor, nullptr, INDEX_NONE);
+		}
+	}
+}
+
+void UTriggerComponentAnalytic::RemoveAnalyticOverlap(AActor* Actor)
+{
+	if (AnalyticOverlaps.RemoveSwap(Actor) > 0)
+	{
+		OverlapTriggerEnd(this, Actor, nullptr, INDEX_NONE);
+	}
+}
+
+bool UTriggerComponentAnalytic::IsWithinExitMargin(const AActor* Actor) const
+{
+	return GetTriggerBounds().ExpandBy(ExitMargin).IsInside(Actor->GetActorLocation());
+}
+
+UShapeComponent* UTriggerComponentAnalytic::AddPhysicsShape(const FTriggerShapeElement& Element)
+{
+	UShapeComponent* Shape = nullptr;
+
+	switch (Element.Type)
+	{
+	case ETriggerShapeType::Sphere:
+	{
+		USphereComponent* Sphere = NewObject<USphereComponent>(GetOwner());
+		Sphere->SetSphereRadius(Element.Radius);
+		Shape = Sphere;
+		break;
+	}
+	case ETriggerShapeType::Capsule:
+	{
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(GetOwner());
+		Capsule->SetCapsuleSize(Element.Radius, Element.CapsuleHalfHeight);
+		Shape = Capsule;
+		break;
+	}
+	default:
+	{
+		UBoxComponent* Box = NewObject<UBoxComponent>(GetOwner());
+		Box->SetBoxExtent(Element.BoxExtent);
+		Shape = Box;
+		break;
+	}
+	}
+
+	Shape->SetupAttachment(this);
+	Shape->SetRelativeTransform(Element.RelativeTransform);
+	Shape->SetGenerateOverlapEvents(true);
+	Shape->RegisterComponent();
+
+	CheckInitialOverlap(Shape);
+
+	Shape->OnComponentBeginOverlap.AddDynamic(this, &UTriggerComponentAnalytic::OverlapTriggerBegin);
+	Shape->OnComponentEndOverlap.AddDynamic(this, &UTriggerComponentAnalytic::OverlapTriggerEnd);
+
+	return Shape;
+}
+
+void UTriggerComponentAnalytic::OverlapTriggerBegin(UPrimitiveComponent *OverlappedComponent, AActor *OtherActor, UPrimitiveComponent *OtherComponent, int32 OtherBodyIndex, bool bFromSweep, const FHitResult &SweepResult)
+{
+	Super::OverlapTriggerBegin(OverlappedComponent, OtherActor, OtherComponent, OtherBodyIndex, bFromSweep, SweepResult);
+}
+
+void UTriggerComponentAnalytic::OverlapTriggerEnd(UPrimitiveComponent *OverlappedComponent, AActor *OtherActor, UPrimitiveComponent *OtherComp, int32 OtherBodyIndex)
+{
+	Super::OverlapTriggerEnd(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TriggerComponentBase.h"
+#include "TriggerShape.h"
+#include "TriggerComponentAnalytic.generated.h"
+
+class UShapeComponent;
+
+/*
+	Abstract analytic Trigger Component
+
+	Containment is tested analytically by UTriggerSubsystem against registered trigger candidates
+	(actors carrying one of the acceptable tags), so these triggers need no physics body.
+	Set bUsePhysicsOverlap for cases that need precise, physics-backed overlaps instead.
+
+	Candidates are gathered from tags when actors spawn or the trigger registers. Unlike UTriggerComponentBox,
+	which checks tags at overlap time, an actor that gains an acceptable tag afterwards (e.g. UGrabber's grabbed
+	tag) is not tested until it is passed to UTriggerSubsystem::RefreshTriggerCandidate.
+*/
+UCLASS(Abstract)
+class MPSTARTER_API UTriggerComponentAnalytic : public UTriggerComponentBase
+{
+	GENERATED_BODY()
+
+public:
+	// ctor
+	UTriggerComponentAnalytic();
+
+	/// @brief Whether or not this trigger relies on physics overlaps instead of analytic tests
+	bool UsesPhysicsOverlap() const { return bUsePhysicsOverlap; }
+
+	/// @brief Acceptable tags, used to gather trigger candidates
+	const TSet<FName>& GetAcceptableActorTags() const { return AcceptableActorTags; }
+
+	/// @brief World space axis aligned bounds of the trigger
+	FBox GetTriggerBounds() const { return GetLocalTriggerBounds().TransformBy(GetComponentTransform()); }
+
+	/// @brief Determines whether or not the world space point lies within the trigger
+	bool ContainsPoint(const FVector& WorldPoint) const { return ContainsLocalPoint(GetComponentTransform().InverseTransformPosition(WorldPoint)); }
+
+	/// @brief Creates the physics shapes or registers for analytic tests
+	virtual void InitializeTrigger() override;
+
+	/// @brief Tests the candidates against the trigger, raising overlap begin/end for those that entered/left
+	/// @param Candidates Candidate actors
+	/// @param Locations World location of each candidate
+	void UpdateAnalyticOverlaps(TArrayView<AActor* const> Candidates, TArrayView<const FVector> Locations);
+
+	/// @brief Raises overlap end for a candidate that is no longer tracked (e.g. destroyed)
+	/// @param Actor Candidate to remove
+	void RemoveAnalyticOverlap(AActor* Actor);
+
+	/// @brief Delegate Callback when a physics overlap event begins (physics overlap only)
+	UFUNCTION()
+	virtual void OverlapTriggerBegin(UPrimitiveComponent *OverlappedComponent, 
+						AActor *OtherActor, 
+						UPrimitiveComponent *OtherComponent, 
+						int32 OtherBodyIndex, 
+						bool bFromSweep, 
+						const FHitResult &SweepResult) override;
+
+	/// @brief Delegate Callback when a physics overlap event ends (physics overlap only)
+	UFUNCTION()
+	virtual void OverlapTriggerEnd(UPrimitiveComponent* OverlappedComponent, 
+						AActor* OtherActor, 
+						UPrimitiveComponent* OtherComp, 
+						int32 OtherBodyIndex) override;
+
+protected:
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// @brief Use physics-backed overlap events instead of analytic containment tests
+	UPROPERTY(EditAnywhere, Category = "Trigger")
+	bool bUsePhysicsOverlap = false;
+
+	/// @brief Determines whether or not the point lies within the trigger
+	/// @param LocalPoint Point in component space
+	virtual bool ContainsLocalPoint(const FVector& LocalPoint) const PURE_VIRTUAL(UTriggerComponentAnalytic::ContainsLocalPoint, return false;);
+
+	/// @brief Axis aligned bounds of the trigger in component space
+	virtual FBox GetLocalTriggerBounds() const PURE_VIRTUAL(UTriggerComponentAnalytic::GetLocalTriggerBounds, return FBox(ForceInit););
+
+	/// @brief Tests the actor's location against the trigger bounds grown by the exit margin, matching the analytic containment test
+	virtual bool IsWithinExitMargin(const AActor* Actor) const override;
+
+	/// @brief Creates the physics shapes used when bUsePhysicsOverlap is set
+	virtual void CreatePhysicsShapes() {}
+
+	/// @brief Creates and registers a physics shape matching the element, bound to the overlap callbacks
+	/// @param Element Shape to create
+	/// @return The created shape component
+	UShapeComponent* AddPhysicsShape(const FTriggerShapeElement& Element);
+
+private:
+	/// @brief Candidates currently inside the trigger
+	/// @remark Weak, so an actor that disappears without ending play is dropped rather than dereferenced
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<8>> AnalyticOverlaps;
+};
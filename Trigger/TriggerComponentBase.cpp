@@ -1,4 +1,59 @@
 #include "TriggerComponentBase.h"
+#include "TriggerSubsystem.h"
+#include "TriggerCondition.h"
+#include "TriggerableMover.h"
+#include "HAL/IConsoleManager.h"
+#include "ComponentStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trigger Trigger_Implementation"), STAT_TriggerTrigger, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger IsAcceptableActor"), STAT_TriggerIsAcceptableActor, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger CheckInitialOverlap"), STAT_TriggerCheckInitialOverlap, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger OverlapBegin"), STAT_TriggerOverlapBegin, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger OverlapEnd"), STAT_TriggerOverlapEnd, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trigger Suppressed Transitions"), STAT_TriggerSuppressedTransitions, STATGROUP_Components);
+
+namespace TriggerComponent
+{
+	/// @brief Interval (s) between checks of an actor held within the exit margin
+	constexpr float ExitMarginCheckInterval = 0.1f;
+
+	/// @brief Compares native and reflection dispatch of Trigger/Reverse on a native triggerable
+	/// @remark The mover has no sequence, so each call returns straight away and only the dispatch is measured
+	static FAutoConsoleCommand BenchmarkDispatchCommand(
+		TEXT("trigger.BenchmarkDispatch"),
+		TEXT("Times [Count = 1000000] triggerable dispatches through the native and reflection paths."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 2) : 1000000;
+			UTriggerableMover* Mover = NewObject<UTriggerableMover>(GetTransientPackage());
+
+			const FTriggerableTarget Native(Mover);
+			FTriggerableTarget Reflection(Mover);
+			Reflection.bNativeTrigger = Reflection.bNativeReverse = false;
+
+			auto Time = [Count](const FTriggerableTarget& Target)
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				for (int32 Index = 0; Index < Count; Index += 2)
+				{
+					Target.Trigger();
+					Target.Reverse();
+				}
+				return FPlatformTime::Seconds() - StartTime;
+			};
+
+			const double NativeSeconds = Time(Native);
+			const double ReflectionSeconds = Time(Reflection);
+
+			UE_LOG(LogTemp, Log, TEXT("Triggerable dispatch x%i: native %.3fms (%.2fns/call), reflection %.3fms (%.2fns/call), %.1fx"),
+				Count,
+				NativeSeconds * 1000.0, NativeSeconds * 1e9 / Count,
+				ReflectionSeconds * 1000.0, ReflectionSeconds * 1e9 / Count,
+				NativeSeconds > 0.0 ? ReflectionSeconds / NativeSeconds : 0.0);
+
+			Mover->MarkAsGarbage();
+		}));
+}
 
 // Sets default values for this component's properties
 UTriggerComponentBase::UTriggerComponentBase()
@@ -9,6 +64,42 @@ UTriggerComponentBase::UTriggerComponentBase()
 void UTriggerComponentBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (AcceptableActorTags.Num() <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Tag for Trigger Key is not set! No actions will happen on overlap! %s"), *GetOwner()->GetActorNameOrLabel());
+	}
+
+	if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+	{
+		TriggerSubsystem->RegisterTrigger(this);
+		TriggerSubsystem->QueueInitialization(this);
+	}
+	else
+	{
+		InitializeTrigger();
+	}
+}
+
+void UTriggerComponentBase::InitializeTrigger()
+{
+	bInitialized = true;
+}
+
+// Called when the game ends
+void UTriggerComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelTriggerTimers();
+
+	if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+	{
+		TriggerSubsystem->UnregisterTrigger(this);
+		TriggerSubsystem->RemoveFollowers(this);
+	}
+
+	CountValidActors(-ActorsValid.Num());
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -19,58 +110,310 @@ void UTriggerComponentBase::TickComponent(float DeltaTime, ELevelTick TickType,
 
 void UTriggerComponentBase::AddTriggerable(IITriggerable* Triggerable)
 {
-	if (!Triggerables.Contains(Triggerable))
+	AddTriggerable(Triggerable ? Triggerable->_getUObject() : nullptr);
+}
+
+void UTriggerComponentBase::AddTriggerable(UObject* Triggerable)
+{
+	if (Triggerable == nullptr || !Triggerable->Implements<UITriggerable>())
+	{
+		return;
+	}
+
+	// Resolve the dispatch path once here rather than on every trigger
+	FTriggerableTarget Target(Triggerable);
+	if (!Triggerables.Contains(Target))
+	{
+		LLM_SCOPE_BYTAG(Components);
+		const SIZE_T AllocatedSize = Triggerables.GetAllocatedSize();
+		Triggerables.Add(Target);
+		TRACK_COMPONENT_ALLOCATION(Triggerables, AllocatedSize);
+	}
+}
+
+#pragma region Snapshot
+void UTriggerComponentBase::SaveTriggerState(FArchive& Ar, FTriggerStateSnapshot& Snapshot) const
+{
+	uint32 NumActors = ActorsValid.Num();
+	Ar.SerializeIntPacked(NumActors);
+
+	for (AActor* Actor : ActorsValid)
+	{
+		uint32 Index = Snapshot.GetActorIndex(Actor);
+		Ar.SerializeIntPacked(Index);
+	}
+}
+
+void UTriggerComponentBase::RestoreTriggerState(FArchive& Ar, const FTriggerStateSnapshot& Snapshot)
+{
+	uint32 NumActors = 0;
+	Ar.SerializeIntPacked(NumActors);
+
+	CountValidActors(-ActorsValid.Num());
+	ActorsValid.Reset();
+	CancelTriggerTimers();
+
+	UTriggerSubsystem* TriggerSubsystem = AttachActor && bFollowWithoutAttaching ? GetWorld()->GetSubsystem<UTriggerSubsystem>() : nullptr;
+	if (TriggerSubsystem)
+	{
+		TriggerSubsystem->RemoveFollowers(this);
+	}
+
+	if (Condition)
+	{
+		Condition->Reset();
+	}
+
+	for (uint32 ActorNum = 0; ActorNum < NumActors; ActorNum++)
 	{
-		Triggerables.Add(Triggerable);
+		uint32 Index = 0;
+		Ar.SerializeIntPacked(Index);
+
+		// Actors destroyed since the capture are dropped
+		if (AActor* Actor = Snapshot.GetActor(Index))
+		{
+			ActorsValid.Add(Actor);
+
+			if (Condition)
+			{
+				Condition->OnActorAdded(Actor);
+			}
+
+			if (TriggerSubsystem)
+			{
+				TriggerSubsystem->AddFollower(this, Actor);
+			}
+		}
 	}
+
+	CountValidActors(ActorsValid.Num());
+
+	// The movers restore their own state, so take on the restored state without fanning out
+	bTriggered = IsConditionMet();
+}
+#pragma endregion
+
+bool UTriggerComponentBase::CanTrigger_Implementation() const
+{
+	return bTriggered;
 }
 
+bool UTriggerComponentBase::IsConditionMet() const
+{
+	if (!bInitialized)
+	{
+		return false;
+	}
+
+	return Condition ? Condition->IsMet(ActorsValid.Num()) : ActorsValid.Num() >= NumberOfActorsNeeded;
+}
+
+#pragma region Debounce
+void UTriggerComponentBase::UpdateTriggerState()
+{
+	const bool bMet = IsConditionMet();
+	UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>();
+
+	// Back where it started before the debounce window passed
+	if (bMet == bTriggered)
+	{
+		if (PendingTransition.IsValid())
+		{
+			TriggerSubsystem->CancelTriggerTimer(PendingTransition);
+			INC_DWORD_STAT(STAT_TriggerSuppressedTransitions);
+		}
+		return;
+	}
+
+	// Already waiting out the window for this change
+	if (PendingTransition.IsValid())
+	{
+		return;
+	}
+
+	const float DebounceTime = bMet ? EnterDebounceTime : ExitDebounceTime;
+	if (DebounceTime > 0.0f && TriggerSubsystem)
+	{
+		PendingTransition = TriggerSubsystem->ScheduleTriggerTimer(DebounceTime, this);
+		return;
+	}
+
+	bTriggered = bMet;
+	Trigger_Implementation();
+}
+
+void UTriggerComponentBase::OnTriggerTimer(const FTimerWheelHandle& Handle, const TWeakObjectPtr<AActor>& Actor)
+{
+	if (Actor.IsExplicitlyNull())
+	{
+		// Any change back within the window cancelled the timer, so the condition still differs
+		if (Handle == PendingTransition)
+		{
+			PendingTransition.Invalidate();
+			bTriggered = IsConditionMet();
+			Trigger_Implementation();
+		}
+		return;
+	}
+
+	FLingeringActor* Lingering = LingeringActors.Find(Actor);
+	if (Lingering == nullptr || !(Lingering->Check == Handle))
+	{
+		return;
+	}
+
+	AActor* LiveActor = Actor.Get();
+	if (IsValid(LiveActor) && !LiveActor->IsActorBeingDestroyed() && IsWithinExitMargin(LiveActor))
+	{
+		Lingering->Check = GetWorld()->GetSubsystem<UTriggerSubsystem>()->ScheduleTriggerTimer(TriggerComponent::ExitMarginCheckInterval, this, LiveActor);
+		return;
+	}
+
+	AActor* Address = Lingering->Address;
+	LingeringActors.Remove(Actor);
+	RemoveValidActor(Address, LiveActor != nullptr);
+	UpdateTriggerState();
+}
+
+void UTriggerComponentBase::CancelTriggerTimers()
+{
+	UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>();
+	if (TriggerSubsystem == nullptr)
+	{
+		return;
+	}
+
+	TriggerSubsystem->CancelTriggerTimer(PendingTransition);
+
+	for (TPair<TWeakObjectPtr<AActor>, FLingeringActor>& Lingering : LingeringActors)
+	{
+		TriggerSubsystem->CancelTriggerTimer(Lingering.Value.Check);
+	}
+	LingeringActors.Reset();
+}
+
+void UTriggerComponentBase::CountValidActors(int32 Delta)
+{
+	if (Delta == 0)
+	{
+		return;
+	}
+
+	if (Delta > 0)
+	{
+		INC_DWORD_STAT_BY(STAT_ValidTriggerActors, Delta);
+	}
+	else
+	{
+		DEC_DWORD_STAT_BY(STAT_ValidTriggerActors, -Delta);
+	}
+
+	if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+	{
+		TriggerSubsystem->AddValidTriggerActors(Delta);
+	}
+}
+
+bool UTriggerComponentBase::IsWithinExitMargin(const AActor* Actor) const
+{
+	const USceneComponent* Root = Actor->GetRootComponent();
+	return Root && Bounds.GetBox().ExpandBy(ExitMargin).Intersect(Root->Bounds.GetBox());
+}
+#pragma endregion
+
 void UTriggerComponentBase::Trigger_Implementation() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_TriggerTrigger);
+
 	if (Triggerables.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Triggerables are empty!"));
+		UE_LOG(LogTemp, Verbose, TEXT("Triggerables are empty!"));
 		return;
 	}
 
-    for (IITriggerable* Triggerable : Triggerables)
+    for (const FTriggerableTarget& Triggerable : Triggerables)
     {
         if (CanTrigger_Implementation())
         {
-            Triggerable->Trigger();
+            Triggerable.Trigger();
         }
         else
         {
-            Triggerable->Reverse();
+            Triggerable.Reverse();
         }
     }
+
+	INC_DWORD_STAT_BY(STAT_TriggerablesFannedOut, Triggerables.Num());
+	CSV_CUSTOM_STAT(Components, TriggerablesFannedOut, Triggerables.Num(), ECsvCustomStatOp::Accumulate);
 }
 
 void UTriggerComponentBase::ValidateActor(AActor* Actor)
 {
-    // Only add to pending if they are not already pending, already valid, or already ignored
-	if (ActorsValid.Num() == 0)
+    // Overlaps are not tracked until the trigger is initialized
+	if (!bInitialized)
 	{
 		return;
 	}
 
+    // Only add to pending if they are not already pending, already valid, or already ignored
 	if (!ActorsValid.Contains(Actor))
 	{
 		if (IsAcceptableActor(Actor))
         {
+            LLM_SCOPE_BYTAG(Components);
+            const SIZE_T AllocatedSize = ActorsValid.GetAllocatedSize();
             ActorsValid.Add(Actor);
+            TRACK_COMPONENT_ALLOCATION(ActorsValid, AllocatedSize);
+            CountValidActors(1);
+
+            // Aggregate before attaching, which disables physics on the actor
+            if (Condition)
+            {
+                Condition->OnActorAdded(Actor);
+            }
+
             AttachActorToTrigger(Actor);
-            Trigger_Implementation();
+            UpdateTriggerState();
         }
     }
 }
 
+void UTriggerComponentBase::RemoveValidActor(AActor* Actor, bool bActorExists)
+{
+	if (ActorsValid.Remove(Actor) == 0)
+	{
+		return;
+	}
+
+	CountValidActors(-1);
+
+	if (Condition)
+	{
+		Condition->OnActorRemoved(Actor);
+	}
+
+	if (bActorExists)
+	{
+		DetachFollower(Actor);
+	}
+}
+
 void UTriggerComponentBase::AttachActorToTrigger(AActor *Actor)
 {
     if (!AttachActor)
     {
         return;
     }
+
+    if (bFollowWithoutAttaching)
+    {
+        if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+        {
+            TriggerSubsystem->AddFollower(this, Actor);
+        }
+        return;
+    }
+
     // Freeze component on the trigger if we're meant to attach actor(s)
     // TODO: Change behavior
     if (UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(Actor->GetRootComponent()))
@@ -80,20 +423,33 @@ void UTriggerComponentBase::AttachActorToTrigger(AActor *Actor)
     }
 }
 
+void UTriggerComponentBase::DetachFollower(AActor* Actor)
+{
+	if (!AttachActor || !bFollowWithoutAttaching)
+	{
+		return;
+	}
+
+	if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+	{
+		TriggerSubsystem->RemoveFollower(this, Actor);
+	}
+}
+
 bool UTriggerComponentBase::IsAcceptableActor(AActor *Actor) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_TriggerIsAcceptableActor);
+
+	// Missing tags are reported once on BeginPlay
 	if (AcceptableActorTags.Num() <= 0)
 	{
-		UE_LOG(LogTemp, Warning, 
-			TEXT("Tag for Trigger Key is not set! No actions will happen on overlap! %s"),
-			*Actor->GetActorNameOrLabel());
 		return false;
 	}
 
-	TArray<FName> &Tags = Actor->Tags;
+	const TArray<FName> &Tags = Actor->Tags;
 
 	// Sift out exclusion tags
-	for (FName Exclude : ExclusionTags)
+	for (const FName& Exclude : ExclusionTags)
 	{
 		if (Tags.Contains(Exclude))
 		{
@@ -102,7 +458,7 @@ bool UTriggerComponentBase::IsAcceptableActor(AActor *Actor) const
 	}
 
 	// Find at least one acceptable tag
-	for (FName Acceptable : AcceptableActorTags)
+	for (const FName& Acceptable : AcceptableActorTags)
 	{
 		if (Tags.Contains(Acceptable))
 		{
@@ -115,12 +471,13 @@ bool UTriggerComponentBase::IsAcceptableActor(AActor *Actor) const
 
 void UTriggerComponentBase::CheckInitialOverlap(UPrimitiveComponent* Component)
 {
-	// Get initial overlapping actors
-	TArray<AActor *> InitialOverlappingActors;
-	Component->GetOverlappingActors(InitialOverlappingActors);
-	if (InitialOverlappingActors.Num() > 0)
+	SCOPE_CYCLE_COUNTER(STAT_TriggerCheckInitialOverlap);
+
+	// Read the overlaps in place rather than gathering the actors into a scratch array.
+	// An actor overlapping with several bodies shows up more than once; ValidateActor ignores repeats.
+	for (const FOverlapInfo& Overlap : Component->GetOverlapInfos())
 	{
-		for (AActor* Actor : InitialOverlappingActors)
+		if (AActor* Actor = Overlap.OverlapInfo.GetActor())
 		{
 			ValidateActor(Actor);
 		}
@@ -130,18 +487,40 @@ void UTriggerComponentBase::CheckInitialOverlap(UPrimitiveComponent* Component)
 #pragma region Delegates
 void UTriggerComponentBase::OverlapTriggerBegin(UPrimitiveComponent *OverlappedComponent, AActor *Actor, UPrimitiveComponent *OtherComponent, int32 OtherBodyIndex, bool bFromSweep, const FHitResult &SweepResult)
 {
-	UE_LOG(LogTemp, Warning, TEXT("Calling OverlapTriggerBegin"));
+	SCOPE_CYCLE_COUNTER(STAT_TriggerOverlapBegin);
+
+	// Came back before leaving the exit margin, so it never stopped being valid
+	if (FLingeringActor* Lingering = LingeringActors.Find(Actor))
+	{
+		GetWorld()->GetSubsystem<UTriggerSubsystem>()->CancelTriggerTimer(Lingering->Check);
+		LingeringActors.Remove(Actor);
+		INC_DWORD_STAT(STAT_TriggerSuppressedTransitions);
+		return;
+	}
+
 	ValidateActor(Actor);
 }
 
 void UTriggerComponentBase::OverlapTriggerEnd(UPrimitiveComponent *OverlappedComponent, AActor *Actor, UPrimitiveComponent *OtherComponent, int32 OtherBodyIndex)
 {
-    if (ActorsValid.Num() > 0)
+	SCOPE_CYCLE_COUNTER(STAT_TriggerOverlapEnd);
+
+	if (!ActorsValid.Contains(Actor) || LingeringActors.Contains(Actor))
 	{
-		ActorsValid.Remove(Actor);
+		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Calling Trigger_Implementation from OverlapTriggerEnd"));
-	Trigger_Implementation();
+	// Hold on to the actor while it is still near the trigger, checking again until it leaves the margin or comes back
+	if (ExitMargin > 0.0f && IsValid(Actor) && !Actor->IsActorBeingDestroyed() && IsWithinExitMargin(Actor))
+	{
+		if (UTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>())
+		{
+			LingeringActors.Add(Actor, { TriggerSubsystem->ScheduleTriggerTimer(TriggerComponent::ExitMarginCheckInterval, this, Actor), Actor });
+			return;
+		}
+	}
+
+	RemoveValidActor(Actor);
+	UpdateTriggerState();
 }
 #pragma endregion
\ No newline at end of file
@@ -6,13 +6,26 @@
 #include "Components/PrimitiveComponent.h"
 #include "ITrigger.h"
 #include "ITriggerable.h"
+#include "TimerWheel.h"
 #include "TriggerComponentBase.generated.h"
 
+struct FTriggerStateSnapshot;
+class UTriggerCondition;
+
+/// @brief Valid actors of a trigger, stored inline for typical plate occupancy so overlaps do not allocate
+using FTriggerActorSet = TSet<AActor*, DefaultKeyFuncs<AActor*>, TInlineSetAllocator<8>>;
+
 /*
 	Abstract Trigger Component base class
 	Inherits from Primitive and implements IITrigger interface
 
+	The trigger only fans out to its triggerables when its state changes. Entering and leaving the satisfied state
+	can be debounced (EnterDebounceTime, ExitDebounceTime), and actors that stop overlapping stay valid while they
+	remain within ExitMargin of the trigger, so actors jittering on an edge do not thrash the triggerables.
+
 	Utilized to create proximity-based trigger components of varying shapes
+		- UTriggerComponentBox: physics overlap box
+		- UTriggerComponentSphere, UTriggerComponentCapsule, UTriggerComponentCompound: analytic containment tests
 	For things that are interactable such as levers, doors, etc., denote those a "triggerables" instead
 */
 UCLASS(Abstract, Blueprintable)
@@ -27,14 +40,45 @@ public:
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/// @brief Adds a natively implemented triggerable to execute
 	void AddTriggerable(IITriggerable* Triggerable);
 
+	/// @brief Adds a triggerable to execute, implemented natively or in Blueprint
+	/// @param Triggerable Object implementing UITriggerable
+	void AddTriggerable(UObject* Triggerable);
+
+	/// @brief Performs the deferred setup (overlap scans, delegate binding) and enables the trigger
+	/// @remark Called by UTriggerSubsystem's time-sliced initialization queue. Does nothing once initialized.
+	virtual void InitializeTrigger();
+
+	/// @brief Whether or not the deferred setup has run. Uninitialized triggers never trigger.
+	bool IsInitialized() const { return bInitialized; }
+
+	/// @brief Writes the valid actors of this trigger to a snapshot
+	/// @param Ar Archive to write to
+	/// @param Snapshot Snapshot the actors are indexed in
+	void SaveTriggerState(FArchive& Ar, FTriggerStateSnapshot& Snapshot) const;
+
+	/// @brief Restores the valid actors of this trigger from a snapshot without scanning for overlaps
+	/// @param Ar Archive to read from
+	/// @param Snapshot Snapshot the actors are indexed in
+	void RestoreTriggerState(FArchive& Ar, const FTriggerStateSnapshot& Snapshot);
+
 	/// @brief Executes the triggerables associated with this trigger
 	void Trigger_Implementation() const override;
 
-	/// @brief Determines whether or not the number of valid actors is greater than or equal to number of actors needed
-	/// @return If the number of valid actors is greater than or equal to number of actors needed
-	bool CanTrigger_Implementation() const override { return ActorsValid.Num() >= NumberOfActorsNeeded; };
+	/// @brief Whether or not the trigger is satisfied, once any debounce window has passed
+	/// @return If the trigger is satisfied
+	bool CanTrigger_Implementation() const override;
+
+	/// @brief Determines whether or not the condition is met, or without one, whether the number of valid actors is greater than or equal to number of actors needed
+	/// @remark Unlike CanTrigger, this is not debounced
+	bool IsConditionMet() const;
+
+	/// @brief Called by UTriggerSubsystem when a debounce window or exit margin check scheduled by this trigger comes due
+	/// @param Handle Handle of the timer
+	/// @param Actor Actor held within the exit margin, or explicitly null for a state change
+	void OnTriggerTimer(const FTimerWheelHandle& Handle, const TWeakObjectPtr<AActor>& Actor);
 
 	/// @brief Delegate Callback when a collision overlap event begins
 	/// @param OverlappedComponent Overlapped component
@@ -66,15 +110,22 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/// @brief Set of positive tags that need to be present on the colliding actor
 	/// @remark This will evaluate if actor has ANY / ONE; not all
 	UPROPERTY(EditAnywhere, Category = "Trigger")
 	TSet<FName> AcceptableActorTags;
 	
 	/// @brief How many actors are needed to satisfy the trigger
-	UPROPERTY(EditAnywhere, Category = "Trigger", Meta = (ClampMin="1"))
+	UPROPERTY(EditAnywhere, Category = "Trigger", Meta = (ClampMin="1", EditCondition = "Condition == nullptr"))
 	int32 NumberOfActorsNeeded = 1;
 
+	/// @brief Optional condition replacing NumberOfActorsNeeded (e.g. total mass or per-tag quota)
+	UPROPERTY(EditAnywhere, Instanced, Category = "Trigger")
+	UTriggerCondition* Condition = nullptr;
+
 	/// @brief The tag names to use for excluding the colliding actor
 	/// @remark This will evaluate if an actor has ANY/ONE; not all
 	UPROPERTY(EditAnywhere, Category = "Trigger")
@@ -85,53 +136,89 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Trigger")
 	bool AttachActor = true;
 
-	/*
-		TODO: Future Me - Get rid of this code smell and implement Selectable Shape Component in editor to
-				- Generate the corresponding Shape Component
-				- Child it to the trigger component
-				- Destroy old shape component and generate new one when editor selection changes (OnSelectChanged non-blueprint delegate?)
-	/// @brief Trigger Shape to use
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (GetOptions = "GetShapeOptions"))
-	UShapeComponent* TriggerShape;
-
-	/// @brief Trigger Shape selection in Editor
-	/// @return Array of Trigger Shape Selectables
-	UFUNCTION(CallInEditor)
-	TArray<UShapeComponent*> GetShapeOptions() {
-		FName Label = "Trigger Area";
-		UBoxComponent *Box = CreateDefaultSubobject<UBoxComponent>(Label);
-		USphereComponent *Sphere = CreateDefaultSubobject<USphereComponent>(Label);
-		UCapsuleComponent *Capsule = CreateDefaultSubobject<UCapsuleComponent>(Label);
-		UShapeComponent *Custom = CreateDefaultSubobject<UShapeComponent>(Label);
-		
-		return {
-			Box,
-			Sphere,
-			Capsule,
-			Custom
-		};
-	}
-	*/
+	/// @brief Whether to carry the actor at a cached offset instead of attaching it (simulating actors are kinematic while carried)
+	/// @remark Cheaper on busy plates and moving triggers; the actor is moved once per frame only when the trigger moved
+	UPROPERTY(EditAnywhere, Category = "Trigger", meta = (EditCondition = "AttachActor"))
+	bool bFollowWithoutAttaching = false;
+
+	/// @brief Time (s) the condition must stay met before the triggerables are triggered
+	UPROPERTY(EditAnywhere, Category = "Trigger|Debounce", Meta = (ClampMin = "0", Units = "s"))
+	float EnterDebounceTime = 0.0f;
+
+	/// @brief Time (s) the condition must stay unmet before the triggerables are reversed
+	UPROPERTY(EditAnywhere, Category = "Trigger|Debounce", Meta = (ClampMin = "0", Units = "s"))
+	float ExitDebounceTime = 0.0f;
+
+	/// @brief Distance an actor must move beyond the trigger bounds after it stops overlapping before it is no longer valid
+	UPROPERTY(EditAnywhere, Category = "Trigger|Debounce", Meta = (ClampMin = "0", Units = "cm"))
+	float ExitMargin = 0.0f;
+
+	/// @brief Whether or not InitializeTrigger has run
+	bool bInitialized = false;
+
+	/// @brief State last fanned out to the triggerables
+	bool bTriggered = false;
+
+	/// @brief Debounced state change waiting to be applied
+	FTimerWheelHandle PendingTransition;
+
+	/// @brief Actor that stopped overlapping but is still within the exit margin
+	struct FLingeringActor
+	{
+		/// @brief Next exit margin check
+		FTimerWheelHandle Check;
+
+		/// @brief Address of the actor in ActorsValid, only used to remove it once the actor is gone. Never dereferenced.
+		AActor* Address = nullptr;
+	};
+
+	/// @brief Actors that stopped overlapping but are still within the exit margin
+	/// @remark Keyed weakly, since a lingering actor can be destroyed or streamed out before its next check
+	TMap<TWeakObjectPtr<AActor>, FLingeringActor, TInlineSetAllocator<4>> LingeringActors;
 
 	/// @brief Collision actors who have acceptable tags and not yet acted on
-	TSet<AActor*> ActorsValid;
+	FTriggerActorSet ActorsValid;
 
 	/// @brief  Array of triggerables to execute
-	TArray<IITriggerable*> Triggerables;
+	TArray<FTriggerableTarget> Triggerables;
 
 	/// @brief Validates the supplied actor. If valid, append to valid actors hashset and trigger events
 	/// @param Actor 
 	void ValidateActor(AActor *Actor);
 
-	/// @brief Attaches the actor to the root component and deactivates physics
+	/// @brief Removes a valid actor, releasing it from the condition and follower list
+	/// @param Actor Actor to remove
+	/// @param bActorExists Whether or not the actor still exists. Actors that are gone are only removed by address;
+	/// their follower entry is pruned by UTriggerSubsystem.
+	void RemoveValidActor(AActor* Actor, bool bActorExists = true);
+
+	/// @brief Fans out to the triggerables if the condition changed, once any debounce window has passed
+	void UpdateTriggerState();
+
+	/// @brief Cancels every pending debounce window and exit margin check
+	void CancelTriggerTimers();
+
+	/// @brief Adjusts STAT_ValidTriggerActors and UTriggerSubsystem's running total, which it reports to the csv profiler
+	/// @param Delta Actors that became valid, or negative for actors that stopped being valid
+	void CountValidActors(int32 Delta);
+
+	/// @brief Determines whether or not an actor that stopped overlapping is still within the exit margin
+	/// @param Actor Actor that stopped overlapping
+	virtual bool IsWithinExitMargin(const AActor* Actor) const;
+
+	/// @brief Attaches the actor to the root component and deactivates physics, or adds it as a follower
 	/// @param Actor Actor to attach
 	void AttachActorToTrigger(AActor *Actor);
 
+	/// @brief Stops carrying an actor added as a follower
+	/// @param Actor Actor to release
+	void DetachFollower(AActor* Actor);
+
 	/// @brief Determines if the provided actor has accepted tag(s) and does not have excluded tag(s)
 	/// @param Actor Overlapped Actor
 	/// @return True if the actor contains the matching tag and no exclusion tag; false if not
 	bool IsAcceptableActor(AActor *Actor) const;
 
-	/// @brief Checks for initial overlapping actors
+	/// @brief Checks for initial overlapping actors, reading the component's overlaps in place
 	void CheckInitialOverlap(UPrimitiveComponent* Component);
 };
@@ -14,6 +14,16 @@ UTriggerComponentBox::UTriggerComponentBox() : UTriggerComponentBase()
 void UTriggerComponentBox::BeginPlay()
 {
     Super::BeginPlay();
+}
+
+void UTriggerComponentBox::InitializeTrigger()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    Super::InitializeTrigger();
 
     CheckInitialOverlap(ShapeComponent);
 
@@ -21,6 +31,12 @@ void UTriggerComponentBox::BeginPlay()
 	ShapeComponent->OnComponentEndOverlap.AddDynamic(this, &UTriggerComponentBox::OverlapTriggerEnd);
 }
 
+bool UTriggerComponentBox::IsWithinExitMargin(const AActor* Actor) const
+{
+    const USceneComponent* Root = Actor->GetRootComponent();
+    return Root && ShapeComponent->Bounds.GetBox().ExpandBy(ExitMargin).Intersect(Root->Bounds.GetBox());
+}
+
 void UTriggerComponentBox::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
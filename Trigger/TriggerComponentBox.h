@@ -48,12 +48,18 @@ public:
 						UPrimitiveComponent* OtherComp, 
 						int32 OtherBodyIndex) override;
 	
+	/// @brief Scans for initial overlaps and binds the overlap delegates
+	virtual void InitializeTrigger() override;
+
 	/// @brief Retrieve BoxComponent subobject
 	FORCEINLINE class UBoxComponent* GetBoxComponent() const { return ShapeComponent; }
 
 protected:
 	virtual void BeginPlay();
 
+	/// @brief Tests the actor's bounds against the box bounds grown by the exit margin
+	virtual bool IsWithinExitMargin(const AActor* Actor) const override;
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Trigger", meta = (AllowPrivateAccess = "true"))
 	class UBoxComponent* ShapeComponent;
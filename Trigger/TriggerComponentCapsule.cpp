@@ -0,0 +1 @@
+#include "TriggerComponentCapsule.h"
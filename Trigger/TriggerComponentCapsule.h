@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TriggerComponentAnalytic.h"
+#include "TriggerComponentCapsule.generated.h"
+
+/**
+ * Z-aligned capsule trigger using an analytic containment test
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MPSTARTER_API UTriggerComponentCapsule : public UTriggerComponentAnalytic
+{
+	GENERATED_BODY()
+
+protected:
+	/// @brief Radius of the trigger
+	UPROPERTY(EditAnywhere, Category = "Trigger", meta = (ClampMin = "0"))
+	float Radius = 50.0;
+
+	/// @brief Half height of the trigger, including its hemispherical caps
+	UPROPERTY(EditAnywhere, Category = "Trigger", meta = (ClampMin = "0"))
+	float HalfHeight = 100.0;
+
+	virtual bool ContainsLocalPoint(const FVector& LocalPoint) const override
+	{
+		return FTriggerShapeElement::MakeCapsule(Radius, HalfHeight).ContainsPoint(LocalPoint);
+	}
+
+	virtual FBox GetLocalTriggerBounds() const override
+	{
+		return FTriggerShapeElement::MakeCapsule(Radius, HalfHeight).GetBounds();
+	}
+
+	virtual void CreatePhysicsShapes() override
+	{
+		AddPhysicsShape(FTriggerShapeElement::MakeCapsule(Radius, HalfHeight));
+	}
+};
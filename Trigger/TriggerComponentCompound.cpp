@@ -0,0 +1,33 @@
+#include "TriggerComponentCompound.h"
+
+bool UTriggerComponentCompound::ContainsLocalPoint(const FVector& LocalPoint) const
+{
+	for (const FTriggerShapeElement& Element : Elements)
+	{
+		if (Element.ContainsPoint(LocalPoint))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FBox UTriggerComponentCompound::GetLocalTriggerBounds() const
+{
+	FBox Bounds(ForceInit);
+	for (const FTriggerShapeElement& Element : Elements)
+	{
+		Bounds += Element.GetBounds();
+	}
+
+	return Bounds;
+}
+
+void UTriggerComponentCompound::CreatePhysicsShapes()
+{
+	for (const FTriggerShapeElement& Element : Elements)
+	{
+		AddPhysicsShape(Element);
+	}
+}
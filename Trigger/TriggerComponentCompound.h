@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TriggerComponentAnalytic.h"
+#include "TriggerComponentCompound.generated.h"
+
+/**
+ * Trigger made up of several box, sphere and capsule elements. An actor inside any element is inside the trigger.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MPSTARTER_API UTriggerComponentCompound : public UTriggerComponentAnalytic
+{
+	GENERATED_BODY()
+
+protected:
+	/// @brief Elements making up the trigger, relative to this component
+	UPROPERTY(EditAnywhere, Category = "Trigger")
+	TArray<FTriggerShapeElement> Elements;
+
+	virtual bool ContainsLocalPoint(const FVector& LocalPoint) const override;
+
+	virtual FBox GetLocalTriggerBounds() const override;
+
+	virtual void CreatePhysicsShapes() override;
+};
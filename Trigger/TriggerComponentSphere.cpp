@@ -0,0 +1 @@
+#include "TriggerComponentSphere.h"
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TriggerComponentAnalytic.h"
+#include "TriggerComponentSphere.generated.h"
+
+/**
+ * Sphere trigger using an analytic containment test
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class MPSTARTER_API UTriggerComponentSphere : public UTriggerComponentAnalytic
+{
+	GENERATED_BODY()
+
+protected:
+	/// @brief Radius of the trigger
+	UPROPERTY(EditAnywhere, Category = "Trigger", meta = (ClampMin = "0"))
+	float Radius = 100.0;
+
+	virtual bool ContainsLocalPoint(const FVector& LocalPoint) const override
+	{
+		return LocalPoint.SizeSquared() <= FMath::Square(Radius);
+	}
+
+	virtual FBox GetLocalTriggerBounds() const override
+	{
+		return FBox(FVector(-Radius), FVector(Radius));
+	}
+
+	virtual void CreatePhysicsShapes() override
+	{
+		AddPhysicsShape(FTriggerShapeElement::MakeSphere(Radius));
+	}
+};
@@ -0,0 +1,101 @@
+#include "TriggerCondition.h"
+#include "Components/PrimitiveComponent.h"
+
+#pragma region Mass
+void UTriggerConditionMass::OnActorAdded(AActor* Actor)
+{
+	const float Mass = GetActorMass(Actor);
+	ActorMasses.Add(Actor, Mass);
+	TotalMass += Mass;
+}
+
+void UTriggerConditionMass::OnActorRemoved(AActor* Actor)
+{
+	float Mass = 0.0;
+	if (ActorMasses.RemoveAndCopyValue(Actor, Mass))
+	{
+		TotalMass = FMath::Max(TotalMass - Mass, 0.0f);
+	}
+}
+
+void UTriggerConditionMass::Reset()
+{
+	ActorMasses.Reset();
+	TotalMass = 0.0;
+}
+
+float UTriggerConditionMass::GetActorMass(const AActor* Actor)
+{
+	const UPrimitiveComponent* Component = Actor ? Cast<UPrimitiveComponent>(Actor->GetRootComponent()) : nullptr;
+	if (Component == nullptr)
+	{
+		return 0.0;
+	}
+
+	// Attached actors have physics disabled, so fall back to the mass calculated from the body setup
+	return Component->IsSimulatingPhysics() ? Component->GetMass() : Component->CalculateMass();
+}
+#pragma endregion
+
+#pragma region Tag Quota
+void UTriggerConditionTagQuota::InitializeCounts()
+{
+	Counts.Reset();
+	QuotasUnmet = 0;
+
+	for (const TPair<FName, int32>& Quota : Quotas)
+	{
+		Counts.Add(Quota.Key, 0);
+		QuotasUnmet += Quota.Value > 0 ? 1 : 0;
+	}
+
+	bCountsInitialized = true;
+}
+
+void UTriggerConditionTagQuota::OnActorAdded(AActor* Actor)
+{
+	if (!bCountsInitialized)
+	{
+		InitializeCounts();
+	}
+
+	for (const FName& Tag : Actor->Tags)
+	{
+		int32* Count = Counts.Find(Tag);
+		if (Count == nullptr)
+		{
+			continue;
+		}
+
+		// Only the transition onto the quota changes the unmet count
+		if (++(*Count) == Quotas[Tag])
+		{
+			QuotasUnmet--;
+		}
+
+		ActorBuckets.Add(Actor, Tag);
+		return;
+	}
+}
+
+void UTriggerConditionTagQuota::OnActorRemoved(AActor* Actor)
+{
+	FName Tag;
+	if (!ActorBuckets.RemoveAndCopyValue(Actor, Tag))
+	{
+		return;
+	}
+
+	int32& Count = Counts[Tag];
+	if (Count-- == Quotas[Tag])
+	{
+		QuotasUnmet++;
+	}
+}
+
+void UTriggerConditionTagQuota::Reset()
+{
+	ActorBuckets.Reset();
+	InitializeCounts();
+}
+#pragma endregion
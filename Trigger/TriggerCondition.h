@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "TriggerCondition.generated.h"
+
+/*
+	Abstract trigger condition
+
+	Replaces the trigger's actor count check. Conditions keep running aggregates that are updated as
+	valid actors are added and removed, so IsMet stays constant time regardless of how many actors
+	are on the trigger.
+*/
+UCLASS(Abstract, EditInlineNew, DefaultToInstanced, CollapseCategories)
+class MPSTARTER_API UTriggerCondition : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/// @brief Called when an actor becomes valid on the trigger
+	/// @param Actor Actor added
+	virtual void OnActorAdded(AActor* Actor) {}
+
+	/// @brief Called when a valid actor leaves the trigger
+	/// @param Actor Actor removed. May be the address of an actor that no longer exists, so only use it as a key.
+	virtual void OnActorRemoved(AActor* Actor) {}
+
+	/// @brief Clears the running aggregates
+	virtual void Reset() {}
+
+	/// @brief Determines whether or not the condition is satisfied
+	/// @param NumValidActors Number of valid actors on the trigger
+	/// @return Whether or not the trigger can trigger
+	virtual bool IsMet(int32 NumValidActors) const PURE_VIRTUAL(UTriggerCondition::IsMet, return false;);
+};
+
+/**
+ * Satisfied once the total mass of the valid actors reaches a threshold
+ */
+UCLASS(meta = (DisplayName = "Total Mass"))
+class MPSTARTER_API UTriggerConditionMass : public UTriggerCondition
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnActorAdded(AActor* Actor) override;
+	virtual void OnActorRemoved(AActor* Actor) override;
+	virtual void Reset() override;
+	virtual bool IsMet(int32 NumValidActors) const override { return TotalMass >= MassThreshold; }
+
+	/// @brief Retrieves the mass of the actor's root primitive, whether or not it is simulating
+	/// @param Actor Actor to weigh
+	/// @return Mass in kg or zero if the actor has no primitive root
+	static float GetActorMass(const AActor* Actor);
+
+protected:
+	/// @brief Total mass (kg) needed to satisfy the trigger
+	UPROPERTY(EditAnywhere, Category = "Trigger", meta = (ClampMin = "0"))
+	float MassThreshold = 100.0;
+
+private:
+	/// @brief Running total of the valid actors' mass
+	float TotalMass = 0.0;
+
+	/// @brief Mass each actor contributed when added, so removal subtracts the same amount
+	TMap<AActor*, float, TInlineSetAllocator<8>> ActorMasses;
+};
+
+/**
+ * Satisfied once every tag has at least its quota of valid actors (e.g. two crates and one player)
+ */
+UCLASS(meta = (DisplayName = "Tag Quota"))
+class MPSTARTER_API UTriggerConditionTagQuota : public UTriggerCondition
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnActorAdded(AActor* Actor) override;
+	virtual void OnActorRemoved(AActor* Actor) override;
+	virtual void Reset() override;
+	virtual bool IsMet(int32 NumValidActors) const override { return bCountsInitialized ? QuotasUnmet == 0 : Quotas.Num() == 0; }
+
+protected:
+	/// @brief Number of valid actors needed per tag. An actor counts towards the first quota tag it carries.
+	UPROPERTY(EditAnywhere, Category = "Trigger")
+	TMap<FName, int32> Quotas;
+
+private:
+	/// @brief Valid actors counted per quota tag
+	TMap<FName, int32> Counts;
+
+	/// @brief Quota tag each actor was counted under
+	TMap<AActor*, FName, TInlineSetAllocator<8>> ActorBuckets;
+
+	/// @brief Number of quotas not yet reached
+	int32 QuotasUnmet = 0;
+
+	/// @brief Whether or not the counts have been set up from the quotas
+	bool bCountsInitialized = false;
+
+	/// @brief Sets up the counts and unmet quotas from the configured quotas
+	void InitializeCounts();
+};
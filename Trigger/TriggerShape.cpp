@@ -0,0 +1,59 @@
+#include "TriggerShape.h"
+
+bool FTriggerShapeElement::ContainsPoint(const FVector& Point) const
+{
+	const FVector Local = RelativeTransform.InverseTransformPosition(Point);
+
+	switch (Type)
+	{
+	case ETriggerShapeType::Sphere:
+		return Local.SizeSquared() <= FMath::Square(Radius);
+
+	case ETriggerShapeType::Capsule:
+	{
+		// Distance to the capsule's inner segment
+		const double SegmentHalfLength = FMath::Max(CapsuleHalfHeight - Radius, 0.0f);
+		const FVector Closest(0.0, 0.0, FMath::Clamp(Local.Z, -SegmentHalfLength, SegmentHalfLength));
+		return FVector::DistSquared(Local, Closest) <= FMath::Square(Radius);
+	}
+
+	default:
+		return FMath::Abs(Local.X) <= BoxExtent.X && FMath::Abs(Local.Y) <= BoxExtent.Y && FMath::Abs(Local.Z) <= BoxExtent.Z;
+	}
+}
+
+FBox FTriggerShapeElement::GetBounds() const
+{
+	FVector Extent;
+	switch (Type)
+	{
+	case ETriggerShapeType::Sphere:
+		Extent = FVector(Radius);
+		break;
+	case ETriggerShapeType::Capsule:
+		Extent = FVector(Radius, Radius, FMath::Max(CapsuleHalfHeight, Radius));
+		break;
+	default:
+		Extent = BoxExtent;
+		break;
+	}
+
+	return FBox(-Extent, Extent).TransformBy(RelativeTransform);
+}
+
+FTriggerShapeElement FTriggerShapeElement::MakeSphere(float SphereRadius)
+{
+	FTriggerShapeElement Element;
+	Element.Type = ETriggerShapeType::Sphere;
+	Element.Radius = SphereRadius;
+	return Element;
+}
+
+FTriggerShapeElement FTriggerShapeElement::MakeCapsule(float CapsuleRadius, float HalfHeight)
+{
+	FTriggerShapeElement Element;
+	Element.Type = ETriggerShapeType::Capsule;
+	Element.Radius = CapsuleRadius;
+	Element.CapsuleHalfHeight = HalfHeight;
+	return Element;
+}
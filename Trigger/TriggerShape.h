@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TriggerShape.generated.h"
+
+/// @brief Primitive used by analytic trigger shapes
+UENUM(BlueprintType)
+enum class ETriggerShapeType : uint8
+{
+	Box,
+	Sphere,
+	Capsule
+};
+
+/*
+	Analytic trigger shape primitive
+
+	Containment is a closed-form point test in the element's space, so no physics body is required.
+	Capsules are aligned to the element's Z axis like UCapsuleComponent.
+*/
+USTRUCT(BlueprintType)
+struct MPSTARTER_API FTriggerShapeElement
+{
+	GENERATED_BODY()
+
+	/// @brief Primitive of this element
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trigger Shape")
+	ETriggerShapeType Type = ETriggerShapeType::Box;
+
+	/// @brief Transform of the element relative to the owning trigger
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trigger Shape")
+	FTransform RelativeTransform;
+
+	/// @brief Half extents of a box
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trigger Shape", meta = (EditCondition = "Type == ETriggerShapeType::Box"))
+	FVector BoxExtent = FVector(32.0);
+
+	/// @brief Radius of a sphere or capsule
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trigger Shape", meta = (ClampMin = "0", EditCondition = "Type != ETriggerShapeType::Box"))
+	float Radius = 32.0;
+
+	/// @brief Half height of a capsule, including its hemispherical caps
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trigger Shape", meta = (ClampMin = "0", EditCondition = "Type == ETriggerShapeType::Capsule"))
+	float CapsuleHalfHeight = 64.0;
+
+	/// @brief Determines whether or not the point lies within the element
+	/// @param Point Point in the owning trigger's space
+	/// @return True if the point is inside the element
+	bool ContainsPoint(const FVector& Point) const;
+
+	/// @brief Axis aligned bounds of the element in the owning trigger's space
+	FBox GetBounds() const;
+
+	static FTriggerShapeElement MakeSphere(float SphereRadius);
+	static FTriggerShapeElement MakeCapsule(float CapsuleRadius, float HalfHeight);
+};
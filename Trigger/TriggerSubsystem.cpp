@@ -0,0 +1,780 @@
+#include "TriggerSubsystem.h"
+#include "TriggerComponentBase.h"
+#include "TriggerComponentAnalytic.h"
+#include "TriggerComponentSphere.h"
+#include "EngineUtils.h"
+#include "TriggerableMover.h"
+#include "ComponentStats.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/StableSort.h"
+#include "MoverMath.h"
+
+DECLARE_CYCLE_STAT(TEXT("TriggerableMover Batch Tick"), STAT_TriggerableMoverBatchTick, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger Deferred Initialization"), STAT_TriggerDeferredInitialization, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trigger Pending Initializations"), STAT_TriggerPendingInitializations, STATGROUP_Components);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Trigger Initialization Max ms"), STAT_TriggerInitMaxMs, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("TriggerableMover Classify"), STAT_TriggerableMoverClassify, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("TriggerableMover Dispatch Events"), STAT_TriggerableMoverDispatchEvents, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger Timers"), STAT_TriggerTimers, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trigger Pending Timers"), STAT_TriggerPendingTimers, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger Update Followers"), STAT_TriggerUpdateFollowers, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger Analytic Overlaps"), STAT_TriggerAnalyticOverlaps, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger CaptureSnapshot"), STAT_TriggerCaptureSnapshot, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Trigger RestoreSnapshot"), STAT_TriggerRestoreSnapshot, STATGROUP_Components);
+
+namespace TriggerSnapshot
+{
+	/// @brief 'TSNP'
+	constexpr uint32 Magic = 0x54534E50;
+}
+
+#pragma region Snapshot
+int32 FTriggerStateSnapshot::GetActorIndex(AActor* Actor)
+{
+	if (int32* Index = ActorIndices.Find(Actor))
+	{
+		return *Index;
+	}
+
+	return ActorIndices.Add(Actor, Actors.Add(Actor));
+}
+
+AActor* FTriggerStateSnapshot::GetActor(int32 Index) const
+{
+	return Actors.IsValidIndex(Index) ? Actors[Index].Get() : nullptr;
+}
+#pragma endregion
+
+namespace TriggerSubsystem
+{
+	static TAutoConsoleVariable<float> CVarInitBudgetMs(
+		TEXT("trigger.InitBudgetMs"),
+		2.0,
+		TEXT("Time budget (ms) per frame for initializing triggers and movers that began play. At least one initialization always runs."));
+
+	/// @brief Most steps a mover catching up on skipped time takes in a frame. Time left over carries to the next frame.
+	constexpr int32 MaxCatchUpSteps = 8;
+
+	template<EStageEasing Easing>
+	void TickMoverBucket(const TArray<TPair<UTriggerableMover*, float>>& Bucket, float MaxStep)
+	{
+		for (const TPair<UTriggerableMover*, float>& Entry : Bucket)
+		{
+			UTriggerableMover* Mover = Entry.Key;
+
+			// Whole loops leave a looping mover where it started, so a mover resuming from a long freeze drops them
+			// and snaps to its phase rather than replaying them
+			float Remaining = Entry.Value;
+			const float LoopPeriod = Mover->GetLoopPeriod();
+			if (LoopPeriod > 0.0f && Remaining >= LoopPeriod)
+			{
+				Remaining = MoverMath::LoopTime(Remaining, LoopPeriod);
+			}
+
+			// Step skipped time in bounded chunks since a mover changes stage at most once per step
+			for (int32 Step = 0; Step < MaxCatchUpSteps && Remaining > 0.0f && Mover->NeedsUpdate(); Step++)
+			{
+				const float StepTime = FMath::Min(Remaining, MaxStep);
+				Mover->TickMover<Easing>(StepTime);
+				Remaining -= StepTime;
+			}
+
+			if (Mover->NeedsUpdate())
+			{
+				Mover->Significance.PendingTime += Remaining;
+			}
+		}
+	}
+
+	/// @brief Times capturing and restoring a snapshot of scratch triggers and movers caught mid-stage
+	/// @remark Each pair is a trigger and a mover on one actor, so the default 5000 pairs is 10000 objects.
+	///	The snapshot also covers every trigger and mover already in the world.
+	static FAutoConsoleCommandWithWorldAndArgs BenchmarkSnapshotCommand(
+		TEXT("trigger.BenchmarkSnapshot"),
+		TEXT("Spawns [Pairs = 5000] scratch actors, each with a trigger and a mover, then times capturing and restoring a snapshot of them."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UTriggerSubsystem* Subsystem = World ? World->GetSubsystem<UTriggerSubsystem>() : nullptr;
+			if (Subsystem == nullptr || !World->HasBegunPlay())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("trigger.BenchmarkSnapshot needs a world that has begun play"));
+				return;
+			}
+
+			const int32 Pairs = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 5000;
+
+			// Scratch triggers have no tags, so keep their warnings out of the log
+			const ELogVerbosity::Type Verbosity = LogTemp.GetVerbosity();
+			LogTemp.SetVerbosity(ELogVerbosity::Error);
+
+			TArray<AActor*> Actors;
+			Actors.Reserve(Pairs);
+
+			for (int32 Index = 0; Index < Pairs; Index++)
+			{
+				AActor* Actor = World->SpawnActor<AActor>();
+				USceneComponent* Root = NewObject<USceneComponent>(Actor);
+				Actor->SetRootComponent(Root);
+				Root->RegisterComponent();
+
+				UTriggerComponentSphere* Trigger = NewObject<UTriggerComponentSphere>(Actor);
+				Trigger->SetupAttachment(Root);
+				Trigger->RegisterComponent();
+
+				UTriggerableMover* Mover = NewObject<UTriggerableMover>(Actor);
+				Mover->RegisterComponent();
+				Mover->SetSequence({
+					FSequenceStage(FStageLocation(FVector(200.0, 0.0, 0.0), 0.5), FStageRotation(0.0, 90.0, 0.0, 0.5)),
+					FSequenceStage(FStageLocation(FVector(0.0, 0.0, 150.0), 0.75), FStageRotation(0.0, 0.0, 0.0, 0.75)) });
+
+				// Initialize now rather than through the time-sliced queue, so none of it lands in the timings
+				Trigger->InitializeTrigger();
+				Mover->InitializeMover();
+				Mover->Trigger_Implementation();
+
+				Actors.Add(Actor);
+			}
+
+			LogTemp.SetVerbosity(Verbosity);
+
+			// Leave the movers part way through their first stage. A quarter second of frames, so movers throttled by
+			// significance get their turns too.
+			for (int32 Frame = 0; Frame < 15; Frame++)
+			{
+				Subsystem->TickMovers(1.0f / 60.0f);
+			}
+
+			FTriggerStateSnapshot Snapshot;
+			const double CaptureStart = FPlatformTime::Seconds();
+			Subsystem->CaptureSnapshot(Snapshot);
+			const double CaptureSeconds = FPlatformTime::Seconds() - CaptureStart;
+
+			const double RestoreStart = FPlatformTime::Seconds();
+			const bool bRestored = Subsystem->RestoreSnapshot(Snapshot);
+			const double RestoreSeconds = FPlatformTime::Seconds() - RestoreStart;
+
+			for (AActor* Actor : Actors)
+			{
+				Actor->Destroy();
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("trigger.BenchmarkSnapshot: %i scratch triggers and %i movers, %i bytes, capture %.3fms, restore %.3fms%s"),
+				Pairs, Pairs, Snapshot.Data.Num(), CaptureSeconds * 1000.0, RestoreSeconds * 1000.0, bRestored ? TEXT("") : TEXT(" (restore failed)"));
+		}));
+}
+
+void FTriggerableMoverTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Subsystem->TickMovers(DeltaTime);
+	}
+}
+
+void UTriggerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Movers set their location before physics runs, same as a component tick would
+	MoverTickFunction.TickGroup = TG_PrePhysics;
+	MoverTickFunction.bCanEverTick = true;
+	MoverTickFunction.bStartWithTickEnabled = true;
+	MoverTickFunction.Subsystem = this;
+	MoverTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UTriggerSubsystem::OnActorSpawned));
+}
+
+void UTriggerSubsystem::Deinitialize()
+{
+	if (MaxInitFrameMs > 0.0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Trigger and mover initialization peaked at %.3fms in a single frame"), MaxInitFrameMs);
+	}
+
+	if (MoverTickFunction.IsTickFunctionRegistered())
+	{
+		MoverTickFunction.UnRegisterTickFunction();
+	}
+	MoverTickFunction.Subsystem = nullptr;
+
+	if (ActorSpawnedHandle.IsValid())
+	{
+		GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		ActorSpawnedHandle.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+void UTriggerSubsystem::TickMovers(float DeltaTime)
+{
+	InitializePending();
+
+	// Debounced transitions and hold wakes land before the movers update
+	AdvanceTriggerTimers(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_TriggerableMoverBatchTick);
+
+	if (bMoverOrderDirty)
+	{
+		bMoverOrderDirty = false;
+		OrderedMovers = Movers;
+		Algo::StableSortBy(OrderedMovers, &UTriggerableMover::GetHierarchyDepth);
+	}
+
+	MoverClassifyCountdown -= DeltaTime;
+	if (MoverClassifyCountdown <= 0.0)
+	{
+		MoverClassifyCountdown = MoverSignificance::GetClassifyInterval();
+		ClassifyMovers();
+	}
+
+	const float MaxStep = FMath::Max(MoverSignificance::GetCatchUpStep(), DeltaTime);
+	int32 BucketedDepth = 0;
+
+	for (UTriggerableMover* Mover : OrderedMovers)
+	{
+		// Idle movers owe nothing, so they resume from where they stopped
+		if (!Mover->NeedsUpdate())
+		{
+			Mover->Significance.PendingTime = 0.0;
+			continue;
+		}
+
+		const float MoverDeltaTime = Mover->Significance.Consume(DeltaTime);
+		if (MoverDeltaTime <= 0.0)
+		{
+			continue;
+		}
+
+		// Nested movers wait for everything they may be riding on. Only nested mechanisms pay for the extra flush.
+		if (Mover->GetHierarchyDepth() != BucketedDepth)
+		{
+			TickMoverBuckets(MaxStep);
+			BucketedDepth = Mover->GetHierarchyDepth();
+		}
+
+		MoverBuckets[(int32)Mover->GetEasingBucket()].Add({ Mover, MoverDeltaTime });
+	}
+
+	TickMoverBuckets(MaxStep);
+
+	// Carry followers before physics sees the new carrier transforms
+	UpdateFollowers();
+}
+
+void UTriggerSubsystem::TickMoverBuckets(float MaxStep)
+{
+	using namespace TriggerSubsystem;
+	TickMoverBucket<EStageEasing::Linear>(MoverBuckets[(int32)EStageEasing::Linear], MaxStep);
+	TickMoverBucket<EStageEasing::SmoothStep>(MoverBuckets[(int32)EStageEasing::SmoothStep], MaxStep);
+	TickMoverBucket<EStageEasing::EaseIn>(MoverBuckets[(int32)EStageEasing::EaseIn], MaxStep);
+	TickMoverBucket<EStageEasing::EaseOut>(MoverBuckets[(int32)EStageEasing::EaseOut], MaxStep);
+	TickMoverBucket<EStageEasing::EaseInOut>(MoverBuckets[(int32)EStageEasing::EaseInOut], MaxStep);
+	TickMoverBucket<EStageEasing::Spring>(MoverBuckets[(int32)EStageEasing::Spring], MaxStep);
+	TickMoverBucket<EStageEasing::Curve>(MoverBuckets[(int32)EStageEasing::Curve], MaxStep);
+
+	// Keep the allocations between flushes and frames
+	for (TArray<TPair<UTriggerableMover*, float>>& Bucket : MoverBuckets)
+	{
+		Bucket.Reset();
+	}
+}
+
+#pragma region Initialization
+void UTriggerSubsystem::QueueInitialization(UActorComponent* Component)
+{
+	LLM_SCOPE_BYTAG(Components);
+	const SIZE_T AllocatedSize = PendingInitializations.GetAllocatedSize();
+	PendingInitializations.Add(Component);
+	TRACK_COMPONENT_ALLOCATION(PendingInitializations, AllocatedSize);
+}
+
+void UTriggerSubsystem::InitializePending()
+{
+	if (NextInitialization == PendingInitializations.Num())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TriggerDeferredInitialization);
+
+	const double BudgetSeconds = TriggerSubsystem::CVarInitBudgetMs.GetValueOnGameThread() / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Always make progress, even if a single initialization is over budget
+	do
+	{
+		UActorComponent* Component = PendingInitializations[NextInitialization++].Get();
+		if (UTriggerComponentBase* Trigger = Cast<UTriggerComponentBase>(Component))
+		{
+			Trigger->InitializeTrigger();
+		}
+		else if (UTriggerableMover* Mover = Cast<UTriggerableMover>(Component))
+		{
+			Mover->InitializeMover();
+		}
+	}
+	while (NextInitialization < PendingInitializations.Num() && FPlatformTime::Seconds() - StartTime < BudgetSeconds);
+
+	if (NextInitialization == PendingInitializations.Num())
+	{
+		PendingInitializations.Reset();
+		NextInitialization = 0;
+	}
+
+	const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	MaxInitFrameMs = FMath::Max(MaxInitFrameMs, FrameMs);
+
+	SET_DWORD_STAT(STAT_TriggerPendingInitializations, PendingInitializations.Num() - NextInitialization);
+	SET_FLOAT_STAT(STAT_TriggerInitMaxMs, MaxInitFrameMs);
+	CSV_CUSTOM_STAT(Components, TriggerInitializationMs, FrameMs, ECsvCustomStatOp::Set);
+}
+#pragma endregion
+
+#pragma region Timers
+FTimerWheelHandle UTriggerSubsystem::ScheduleTriggerTimer(float Delay, UTriggerComponentBase* Trigger, AActor* Actor)
+{
+	LLM_SCOPE_BYTAG(Components);
+	return TriggerTimers.Schedule(Delay, { Trigger, Actor });
+}
+
+FTimerWheelHandle UTriggerSubsystem::ScheduleMoverWake(float Delay, UTriggerableMover* Mover)
+{
+	LLM_SCOPE_BYTAG(Components);
+
+	FTriggerTimer Timer;
+	Timer.Mover = Mover;
+	return TriggerTimers.Schedule(Delay, Timer);
+}
+
+void UTriggerSubsystem::CancelTriggerTimer(FTimerWheelHandle& Handle)
+{
+	TriggerTimers.Cancel(Handle);
+}
+
+void UTriggerSubsystem::AdvanceTriggerTimers(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TriggerTimers);
+
+	TriggerTimers.Advance(DeltaTime, [DeltaTime](const FTimerWheelHandle& Handle, const FTriggerTimer& Timer)
+	{
+		if (Timer.Mover)
+		{
+			Timer.Mover->OnHoldExpired(Handle, DeltaTime);
+		}
+		else
+		{
+			Timer.Trigger->OnTriggerTimer(Handle, Timer.Actor);
+		}
+	});
+
+	SET_DWORD_STAT(STAT_TriggerPendingTimers, TriggerTimers.Num());
+}
+#pragma endregion
+
+void UTriggerSubsystem::ClassifyMovers()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TriggerableMoverClassify);
+
+	MoverSignificance::GatherViewLocations(GetWorld(), ViewLocations);
+
+	for (UTriggerableMover* Mover : Movers)
+	{
+		Mover->Significance.Tier = MoverSignificance::Classify(Mover->GetOwner(), ViewLocations);
+	}
+}
+
+void UTriggerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UpdateAnalyticTriggers();
+	DispatchMoverEvents();
+
+	CSV_CUSTOM_STAT(Components, ValidTriggerActors, NumValidTriggerActors, ECsvCustomStatOp::Accumulate);
+}
+
+TStatId UTriggerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTriggerSubsystem, STATGROUP_Components);
+}
+
+#pragma region Events
+void UTriggerSubsystem::QueueMoverEvent(UTriggerableMover* Mover, EMoverEvent Event, int32 StageIndex)
+{
+	if (!OnMoverEvents.IsBound() && !Mover->OnMoverEvent.IsBound())
+	{
+		return;
+	}
+
+	PendingMoverEvents.Add({ Mover, Event, StageIndex });
+}
+
+void UTriggerSubsystem::DispatchMoverEvents()
+{
+	if (PendingMoverEvents.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TriggerableMoverDispatchEvents);
+
+	// Swap so both arrays keep their allocations between frames
+	Swap(PendingMoverEvents, DispatchingMoverEvents);
+	PendingMoverEvents.Reset();
+
+	OnMoverEvents.Broadcast(DispatchingMoverEvents);
+
+	for (const FMoverEvent& MoverEvent : DispatchingMoverEvents)
+	{
+		UTriggerableMover* Mover = MoverEvent.Mover.Get();
+		if (Mover && Mover->OnMoverEvent.IsBound())
+		{
+			Mover->OnMoverEvent.Broadcast(MoverEvent.Event, MoverEvent.StageIndex);
+		}
+	}
+
+	DispatchingMoverEvents.Reset();
+}
+#pragma endregion
+
+#pragma region Followers
+FTriggerFollowerGroup* UTriggerSubsystem::FindFollowerGroup(const UTriggerComponentBase* Carrier)
+{
+	return FollowerGroups.FindByPredicate([Carrier](const FTriggerFollowerGroup& Group) { return Group.Carrier == Carrier; });
+}
+
+void UTriggerSubsystem::AddFollower(UTriggerComponentBase* Carrier, AActor* Actor)
+{
+	USceneComponent* Component = Actor->GetRootComponent();
+	if (Component == nullptr)
+	{
+		return;
+	}
+
+	FTriggerFollowerGroup* Group = FindFollowerGroup(Carrier);
+	if (Group == nullptr)
+	{
+		LLM_SCOPE_BYTAG(Components);
+		const SIZE_T AllocatedSize = FollowerGroups.GetAllocatedSize();
+		Group = &FollowerGroups.AddDefaulted_GetRef();
+		TRACK_COMPONENT_ALLOCATION(FollowerGroups, AllocatedSize);
+
+		Group->Carrier = Carrier;
+		Group->CarrierTransform = Carrier->GetComponentTransform();
+	}
+
+	// Held kinematic for the capture, so the follower only moves with its carrier
+	UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+	const bool bWasSimulating = Primitive && Primitive->IsSimulatingPhysics();
+	if (bWasSimulating)
+	{
+		Primitive->SetSimulatePhysics(false);
+	}
+
+	Group->Followers.Add({ Component, Component->GetComponentTransform().GetRelativeTransform(Group->CarrierTransform), bWasSimulating });
+}
+
+void UTriggerSubsystem::ReleaseFollower(const FTriggerFollower& Follower)
+{
+	if (!Follower.bWasSimulating)
+	{
+		return;
+	}
+
+	if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Follower.Component.Get()))
+	{
+		Primitive->SetSimulatePhysics(true);
+	}
+}
+
+void UTriggerSubsystem::RemoveFollower(UTriggerComponentBase* Carrier, AActor* Actor)
+{
+	FTriggerFollowerGroup* Group = FindFollowerGroup(Carrier);
+	if (Group == nullptr)
+	{
+		return;
+	}
+
+	const USceneComponent* Component = Actor->GetRootComponent();
+	Group->Followers.RemoveAllSwap([Component](const FTriggerFollower& Follower)
+	{
+		if (Follower.Component != Component)
+		{
+			return false;
+		}
+
+		ReleaseFollower(Follower);
+		return true;
+	});
+
+	if (Group->Followers.Num() == 0)
+	{
+		RemoveFollowers(Carrier);
+	}
+}
+
+void UTriggerSubsystem::RemoveFollowers(UTriggerComponentBase* Carrier)
+{
+	if (FTriggerFollowerGroup* Group = FindFollowerGroup(Carrier))
+	{
+		for (const FTriggerFollower& Follower : Group->Followers)
+		{
+			ReleaseFollower(Follower);
+		}
+	}
+
+	FollowerGroups.RemoveAllSwap([Carrier](const FTriggerFollowerGroup& Group) { return Group.Carrier == Carrier; });
+}
+
+void UTriggerSubsystem::UpdateFollowers()
+{
+	if (FollowerGroups.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TriggerUpdateFollowers);
+
+	for (FTriggerFollowerGroup& Group : FollowerGroups)
+	{
+		const FTransform& CarrierTransform = Group.Carrier->GetComponentTransform();
+		if (CarrierTransform.Equals(Group.CarrierTransform))
+		{
+			continue;
+		}
+
+		Group.CarrierTransform = CarrierTransform;
+
+		for (int32 Index = Group.Followers.Num() - 1; Index >= 0; Index--)
+		{
+			const FTriggerFollower& Follower = Group.Followers[Index];
+			USceneComponent* Component = Follower.Component.Get();
+			if (Component == nullptr)
+			{
+				Group.Followers.RemoveAtSwap(Index, 1, false);
+				continue;
+			}
+
+			Component->SetWorldTransform(Follower.RelativeTransform * CarrierTransform, false, nullptr, ETeleportType::TeleportPhysics);
+		}
+	}
+}
+#pragma endregion
+
+#pragma region Analytic Triggers
+void UTriggerSubsystem::RegisterAnalyticTrigger(UTriggerComponentAnalytic* Trigger)
+{
+	AnalyticTriggers.AddUnique(Trigger);
+
+	// Only scan the world for tags we have not gathered candidates for yet
+	TSet<FName> NewTags;
+	for (const FName& Tag : Trigger->GetAcceptableActorTags())
+	{
+		if (!CandidateTags.Contains(Tag))
+		{
+			NewTags.Add(Tag);
+			CandidateTags.Add(Tag);
+		}
+	}
+
+	if (NewTags.Num() == 0)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		for (const FName& Tag : It->Tags)
+		{
+			if (NewTags.Contains(Tag))
+			{
+				AddTriggerCandidate(*It);
+				break;
+			}
+		}
+	}
+}
+
+void UTriggerSubsystem::UnregisterAnalyticTrigger(UTriggerComponentAnalytic* Trigger)
+{
+	AnalyticTriggers.Remove(Trigger);
+}
+
+void UTriggerSubsystem::AddTriggerCandidate(AActor* Actor)
+{
+	if (Actor == nullptr)
+	{
+		return;
+	}
+
+	bool bAlreadyCandidate = false;
+	TriggerCandidates.Add(Actor, &bAlreadyCandidate);
+	if (bAlreadyCandidate)
+	{
+		return;
+	}
+
+	// End play covers destruction as well as levels streaming out, which never destroy their actors
+	Actor->OnEndPlay.AddDynamic(this, &UTriggerSubsystem::OnTriggerCandidateEndPlay);
+}
+
+void UTriggerSubsystem::RefreshTriggerCandidate(AActor* Actor)
+{
+	if (Actor && HasCandidateTag(Actor))
+	{
+		AddTriggerCandidate(Actor);
+	}
+}
+
+bool UTriggerSubsystem::HasCandidateTag(const AActor* Actor) const
+{
+	for (const FName& Tag : Actor->Tags)
+	{
+		if (CandidateTags.Contains(Tag))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UTriggerSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (Actor && HasCandidateTag(Actor))
+	{
+		AddTriggerCandidate(Actor);
+	}
+}
+
+void UTriggerSubsystem::OnTriggerCandidateEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	Actor->OnEndPlay.RemoveDynamic(this, &UTriggerSubsystem::OnTriggerCandidateEndPlay);
+	TriggerCandidates.Remove(Actor);
+
+	for (UTriggerComponentAnalytic* Trigger : AnalyticTriggers)
+	{
+		Trigger->RemoveAnalyticOverlap(Actor);
+	}
+}
+
+void UTriggerSubsystem::UpdateAnalyticTriggers()
+{
+	if (AnalyticTriggers.Num() == 0 || TriggerCandidates.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TriggerAnalyticOverlaps);
+
+	// Gather the live candidates and their locations once so every trigger tests against flat arrays
+	TriggerCandidateActors.Reset();
+	TriggerCandidateLocations.Reset();
+	for (TSet<TWeakObjectPtr<AActor>>::TIterator It = TriggerCandidates.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It->Get();
+		if (Actor == nullptr)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		TriggerCandidateActors.Add(Actor);
+		TriggerCandidateLocations.Add(Actor->GetActorLocation());
+	}
+
+	for (UTriggerComponentAnalytic* Trigger : AnalyticTriggers)
+	{
+		Trigger->UpdateAnalyticOverlaps(TriggerCandidateActors, TriggerCandidateLocations);
+	}
+}
+#pragma endregion
+
+#pragma region Registration
+void UTriggerSubsystem::RegisterTrigger(UTriggerComponentBase* Trigger)
+{
+	Triggers.AddUnique(Trigger);
+}
+
+void UTriggerSubsystem::UnregisterTrigger(UTriggerComponentBase* Trigger)
+{
+	Triggers.Remove(Trigger);
+}
+
+void UTriggerSubsystem::RegisterMover(UTriggerableMover* Mover)
+{
+	Movers.AddUnique(Mover);
+	bMoverOrderDirty = true;
+}
+
+void UTriggerSubsystem::UnregisterMover(UTriggerableMover* Mover)
+{
+	Movers.Remove(Mover);
+	bMoverOrderDirty = true;
+}
+#pragma endregion
+
+void UTriggerSubsystem::CaptureSnapshot(FTriggerStateSnapshot& OutSnapshot)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TriggerCaptureSnapshot);
+	LLM_SCOPE_BYTAG(Components);
+
+	OutSnapshot = FTriggerStateSnapshot();
+	FMemoryWriter Writer(OutSnapshot.Data);
+
+	uint32 Magic = TriggerSnapshot::Magic;
+	int32 NumTriggers = Triggers.Num();
+	int32 NumMovers = Movers.Num();
+	Writer << Magic << NumTriggers << NumMovers;
+
+	for (UTriggerComponentBase* Trigger : Triggers)
+	{
+		Trigger->SaveTriggerState(Writer, OutSnapshot);
+	}
+
+	for (UTriggerableMover* Mover : Movers)
+	{
+		Mover->SerializeMoverState(Writer);
+	}
+}
+
+bool UTriggerSubsystem::RestoreSnapshot(const FTriggerStateSnapshot& Snapshot)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TriggerRestoreSnapshot);
+
+	const double StartTime = FPlatformTime::Seconds();
+	FMemoryReader Reader(Snapshot.Data);
+
+	uint32 Magic = 0;
+	int32 NumTriggers = 0;
+	int32 NumMovers = 0;
+	Reader << Magic << NumTriggers << NumMovers;
+
+	// Snapshots are only valid for the set of triggers and movers they were captured from
+	if (Magic != TriggerSnapshot::Magic || NumTriggers != Triggers.Num() || NumMovers != Movers.Num())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Trigger snapshot does not match the registered triggers (%i/%i) and movers (%i/%i)!"),
+			NumTriggers, Triggers.Num(), NumMovers, Movers.Num());
+		return false;
+	}
+
+	for (UTriggerComponentBase* Trigger : Triggers)
+	{
+		Trigger->RestoreTriggerState(Reader, Snapshot);
+	}
+
+	for (UTriggerableMover* Mover : Movers)
+	{
+		Mover->SerializeMoverState(Reader);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Restored %i triggers and %i movers in %.3fms"),
+		NumTriggers, NumMovers, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return !Reader.IsError();
+}
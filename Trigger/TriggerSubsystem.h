@@ -0,0 +1,350 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "MovementRotation/StageEasing.h"
+#include "MoverEvents.h"
+#include "TimerWheel.h"
+#include "TriggerSubsystem.generated.h"
+
+class UTriggerComponentBase;
+class UTriggerComponentAnalytic;
+class UTriggerableMover;
+class UTriggerSubsystem;
+
+/// @brief Pre-physics tick that runs the batched mover update
+USTRUCT()
+struct FTriggerableMoverTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/// @brief Subsystem to update
+	UTriggerSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override { return TEXT("FTriggerableMoverTickFunction"); }
+};
+
+template<>
+struct TStructOpsTypeTraits<FTriggerableMoverTickFunction> : public TStructOpsTypeTraitsBase2<FTriggerableMoverTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/// @brief Actor carried by a trigger without being attached to it
+struct FTriggerFollower
+{
+	/// @brief Root of the carried actor
+	TWeakObjectPtr<USceneComponent> Component;
+
+	/// @brief Transform of the root relative to the carrier when it was captured
+	FTransform RelativeTransform;
+
+	/// @brief Whether or not the root was simulating physics when captured, and resumes when released
+	bool bWasSimulating = false;
+};
+
+/// @brief Followers of a single trigger
+struct FTriggerFollowerGroup
+{
+	/// @brief Trigger carrying the followers
+	UTriggerComponentBase* Carrier = nullptr;
+
+	/// @brief Carrier transform the followers were last placed against
+	FTransform CarrierTransform;
+
+	/// @brief Carried actors
+	TArray<FTriggerFollower, TInlineAllocator<4>> Followers;
+};
+
+/// @brief Pending trigger transition or mover hold on the subsystem's timer wheel
+struct FTriggerTimer
+{
+	/// @brief Trigger the timer belongs to
+	UTriggerComponentBase* Trigger = nullptr;
+
+	/// @brief Actor held within the exit margin, or explicitly null for a debounced state change
+	/// @remark Weak, since the actor can be destroyed or streamed out while the timer waits
+	TWeakObjectPtr<AActor> Actor;
+
+	/// @brief Mover the timer wakes, if it is a hold
+	UTriggerableMover* Mover = nullptr;
+};
+
+/// @brief Compact snapshot of every registered trigger and mover in a world
+struct MPSTARTER_API FTriggerStateSnapshot
+{
+	/// @brief Contiguous trigger and mover state
+	TArray<uint8> Data;
+
+	/// @brief Actors referenced by the trigger state, stored in Data by index
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	/// @brief Retrieves the index of an actor, adding it if it is not referenced yet
+	/// @param Actor Actor to index
+	/// @return Index of the actor in Actors
+	int32 GetActorIndex(AActor* Actor);
+
+	/// @brief Retrieves the actor stored at the index
+	/// @param Index Index into Actors
+	/// @return The actor or nullptr if the index is invalid or the actor is gone
+	AActor* GetActor(int32 Index) const;
+
+private:
+	/// @brief Actor lookup while capturing
+	TMap<AActor*, int32> ActorIndices;
+};
+
+/*
+	World-wide registry of trigger components and triggerable movers
+
+	Triggers and movers register themselves on BeginPlay which allows level-wide operations
+	(such as checkpoint snapshot/restore) without iterating every actor in the world.
+
+	Movers do not tick on their own. They are updated in a single pre-physics pass, bucketed by the
+	easing profile of their current stage so each bucket runs its compile-time specialized evaluator.
+	The pass is ordered by hierarchy depth: movers riding other movers (see bRelativeToParent) are only
+	bucketed once every shallower mover has updated, so parents always move before their children.
+	Movers far from or hidden from every player update at a reduced rate or freeze (see MoverSignificance.h),
+	catching up on the skipped time in bounded steps when they next update.
+
+	Mover lifecycle events are queued and delivered once at the end of the frame: native listeners of
+	OnMoverEvents receive every event in one call, then each mover's Blueprint delegate is broadcast.
+
+	Trigger and mover setup (overlap scans, delegate binding, origin reads, stage baking) is queued on
+	BeginPlay and run at the start of the pre-physics pass, time-sliced by trigger.InitBudgetMs, so a
+	streaming level with hundreds of them does not land in a single frame. Triggers stay disabled until
+	they are initialized.
+
+	Triggers set to follow rather than attach hand their captured actors to a follower list here. After
+	the movers update, followers whose carrier moved are teleported to their cached relative transform
+	in one pass, without reparenting. Simulating followers are made kinematic while captured, so gravity and
+	leftover velocity cannot slide them off a carrier between moves, and resume simulating when released.
+
+	Trigger debounce windows, exit margin checks and mover holds are timers on a single hierarchical timer
+	wheel turned at the start of the pre-physics pass, so pending transitions cost nothing per frame until
+	they come due. Holding movers sleep, dropping out of the batched update until the wheel wakes them.
+
+	Analytic triggers (sphere, capsule, compound) are tested here once per frame against the trigger
+	candidates: every actor carrying one of their acceptable tags when it spawned or when the trigger
+	registered. Tags are not watched, so actors that gain an acceptable tag later (e.g. a grabbed tag) must be
+	passed to RefreshTriggerCandidate to be tested.
+*/
+UCLASS()
+class MPSTARTER_API UTriggerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/// @brief Native listeners receiving the batch of mover events raised during the frame
+	FOnMoverEvents OnMoverEvents;
+
+	/// @brief Register a trigger with the subsystem
+	void RegisterTrigger(UTriggerComponentBase* Trigger);
+
+	/// @brief Unregister a trigger from the subsystem
+	void UnregisterTrigger(UTriggerComponentBase* Trigger);
+
+	/// @brief Register an analytic trigger, gathering candidates for any acceptable tags not seen before
+	void RegisterAnalyticTrigger(UTriggerComponentAnalytic* Trigger);
+
+	/// @brief Unregister an analytic trigger
+	void UnregisterAnalyticTrigger(UTriggerComponentAnalytic* Trigger);
+
+	/// @brief Adds an actor to be tested against the analytic triggers
+	/// @param Actor Actor to test
+	UFUNCTION(BlueprintCallable, Category = "Trigger")
+	void AddTriggerCandidate(AActor* Actor);
+
+	/// @brief Re-evaluates the tags of an actor, adding it as a candidate if it now carries a tag an analytic trigger accepts
+	/// @remark Call after adding tags at runtime. Candidates that lose their tags are rejected by the triggers' tag checks.
+	/// @param Actor Actor whose tags changed
+	UFUNCTION(BlueprintCallable, Category = "Trigger")
+	void RefreshTriggerCandidate(AActor* Actor);
+
+	/// @brief Queues a trigger or mover for time-sliced initialization
+	/// @param Component UTriggerComponentBase or UTriggerableMover to initialize
+	void QueueInitialization(UActorComponent* Component);
+
+	/// @brief Most time (ms) a single frame has spent initializing triggers and movers
+	double GetMaxInitFrameMs() const { return MaxInitFrameMs; }
+
+	/// @brief Adjusts the count of actors satisfying a trigger in this world, reported to the csv profiler every frame
+	/// @remark Kept here so every trigger type is counted without a component tick
+	void AddValidTriggerActors(int32 Delta) { NumValidTriggerActors += Delta; }
+
+	/// @brief Schedules a debounced state change or exit margin check for a trigger
+	/// @param Delay Time (s) until the trigger is called back with OnTriggerTimer
+	/// @param Trigger Trigger to call back
+	/// @param Actor Actor held within the exit margin, or nullptr for a state change
+	FTimerWheelHandle ScheduleTriggerTimer(float Delay, UTriggerComponentBase* Trigger, AActor* Actor = nullptr);
+
+	/// @brief Schedules a holding mover to wake
+	/// @param Delay Time (s) until the mover is called back with OnHoldExpired
+	/// @param Mover Mover to wake
+	FTimerWheelHandle ScheduleMoverWake(float Delay, UTriggerableMover* Mover);
+
+	/// @brief Time (s) the trigger timer wheel has been turned to, used to measure how late a timer fired
+	double GetTriggerTimerTime() const { return TriggerTimers.GetTime(); }
+
+	/// @brief Cancels a trigger timer or mover wake and invalidates the handle
+	void CancelTriggerTimer(FTimerWheelHandle& Handle);
+
+	/// @brief Starts carrying an actor with a trigger at its current relative transform
+	/// @param Carrier Trigger carrying the actor
+	/// @param Actor Actor to carry
+	void AddFollower(UTriggerComponentBase* Carrier, AActor* Actor);
+
+	/// @brief Stops carrying an actor
+	/// @param Carrier Trigger carrying the actor
+	/// @param Actor Actor to release
+	void RemoveFollower(UTriggerComponentBase* Carrier, AActor* Actor);
+
+	/// @brief Stops carrying every actor of a trigger
+	/// @param Carrier Trigger carrying the actors
+	void RemoveFollowers(UTriggerComponentBase* Carrier);
+
+	/// @brief Moves the followers of every carrier that moved since the last update
+	void UpdateFollowers();
+
+	/// @brief Register a mover with the subsystem
+	void RegisterMover(UTriggerableMover* Mover);
+
+	/// @brief Unregister a mover from the subsystem
+	void UnregisterMover(UTriggerableMover* Mover);
+
+	/// @brief Re-sorts the batched update by hierarchy depth before the next update
+	void InvalidateMoverOrder() { bMoverOrderDirty = true; }
+
+	/// @brief Captures the valid actors of every trigger and the sequence state of every mover
+	/// @param OutSnapshot Snapshot to write to
+	void CaptureSnapshot(FTriggerStateSnapshot& OutSnapshot);
+
+	/// @brief Applies a snapshot captured in this world without re-running BeginPlay or overlap scans
+	/// @param Snapshot Snapshot to restore
+	/// @return Whether or not the snapshot matched the registered triggers and movers and was applied
+	bool RestoreSnapshot(const FTriggerStateSnapshot& Snapshot);
+
+	/// @brief Updates every mover that needs it, bucketed by easing profile
+	/// @param DeltaTime Time difference between frame changes
+	void TickMovers(float DeltaTime);
+
+	/// @brief Queues a mover event for end of frame delivery. Dropped if nothing is listening.
+	/// @param Mover Mover raising the event
+	/// @param Event Event raised
+	/// @param StageIndex Stage the mover is on
+	void QueueMoverEvent(UTriggerableMover* Mover, EMoverEvent Event, int32 StageIndex);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Called at the end of every frame
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/// @brief Events raised this frame
+	TArray<FMoverEvent> PendingMoverEvents;
+
+	/// @brief Events being delivered. Events raised by listeners go to the next frame.
+	TArray<FMoverEvent> DispatchingMoverEvents;
+
+	/// @brief Delivers the queued mover events
+	void DispatchMoverEvents();
+
+	/// @brief Registered analytic triggers
+	TArray<UTriggerComponentAnalytic*> AnalyticTriggers;
+
+	/// @brief Union of the acceptable tags of every analytic trigger
+	TSet<FName> CandidateTags;
+
+	/// @brief Actors tested against the analytic triggers
+	/// @remark Weak, so candidates that leave without ending play (e.g. garbage collected with their level) are pruned.
+	/// A set, so spawns, end play and world scans stay constant time per actor with thousands of candidates.
+	TSet<TWeakObjectPtr<AActor>> TriggerCandidates;
+
+	/// @brief Live candidates, gathered every frame alongside their locations
+	TArray<AActor*> TriggerCandidateActors;
+
+	/// @brief World location of each candidate, refreshed every frame
+	TArray<FVector> TriggerCandidateLocations;
+
+	/// @brief Handle of the actor spawned listener
+	FDelegateHandle ActorSpawnedHandle;
+
+	/// @brief Whether or not the actor carries any of the candidate tags
+	bool HasCandidateTag(const AActor* Actor) const;
+
+	/// @brief Adds newly spawned actors carrying a candidate tag
+	void OnActorSpawned(AActor* Actor);
+
+	/// @brief Drops a candidate that was destroyed or streamed out, ending its overlaps
+	UFUNCTION()
+	void OnTriggerCandidateEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	/// @brief Tests every candidate against every analytic trigger
+	void UpdateAnalyticTriggers();
+
+	/// @brief Components waiting to be initialized, in queue order
+	TArray<TWeakObjectPtr<UActorComponent>> PendingInitializations;
+
+	/// @brief Index of the next component to initialize. The array is compacted once drained.
+	int32 NextInitialization = 0;
+
+	/// @brief Most time (ms) a single frame has spent initializing
+	double MaxInitFrameMs = 0.0;
+
+	/// @brief Actors satisfying a trigger in this world
+	int32 NumValidTriggerActors = 0;
+
+	/// @brief Initializes queued components within the frame budget
+	void InitializePending();
+
+	/// @brief Pending trigger transitions
+	TTimerWheel<FTriggerTimer> TriggerTimers;
+
+	/// @brief Turns the trigger timer wheel, calling back the triggers whose timers came due
+	void AdvanceTriggerTimers(float DeltaTime);
+
+	/// @brief Followers grouped by carrier
+	TArray<FTriggerFollowerGroup> FollowerGroups;
+
+	/// @brief Retrieves the follower group of a carrier
+	/// @return The group or nullptr if the carrier has no followers
+	FTriggerFollowerGroup* FindFollowerGroup(const UTriggerComponentBase* Carrier);
+
+	/// @brief Hands a follower back to physics if it was simulating when captured
+	static void ReleaseFollower(const FTriggerFollower& Follower);
+
+	/// @brief Tick function driving the batched mover update
+	FTriggerableMoverTickFunction MoverTickFunction;
+
+	/// @brief Movers to update this frame with the time to advance them by, indexed by EStageEasing. Kept between frames to avoid reallocating.
+	TArray<TPair<UTriggerableMover*, float>> MoverBuckets[(int32)EStageEasing::Count];
+
+	/// @brief Registered movers sorted by hierarchy depth, in registration order within a depth
+	TArray<UTriggerableMover*> OrderedMovers;
+
+	/// @brief Whether or not OrderedMovers needs rebuilding
+	bool bMoverOrderDirty = false;
+
+	/// @brief Updates and empties every easing bucket
+	/// @param MaxStep Longest single step a mover catching up may take
+	void TickMoverBuckets(float MaxStep);
+
+	/// @brief Time until the movers are next classified into update tiers
+	float MoverClassifyCountdown = 0.0;
+
+	/// @brief Player view points used to classify the movers
+	TArray<FVector> ViewLocations;
+
+	/// @brief Classifies every mover into an update tier by distance to and visibility from the players
+	void ClassifyMovers();
+
+	/// @brief Registered triggers in registration order
+	TArray<UTriggerComponentBase*> Triggers;
+
+	/// @brief Registered movers in registration order
+	TArray<UTriggerableMover*> Movers;
+};
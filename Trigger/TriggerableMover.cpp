@@ -1,19 +1,115 @@
 #include "TriggerableMover.h"
+#include "TriggerSubsystem.h"
+#include "ComponentStats.h"
+#include "MoverMath.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+DECLARE_CYCLE_STAT(TEXT("TriggerableMover MoveAndRotate"), STAT_TriggerableMoverMoveAndRotate, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("TriggerableMover UpdateStages"), STAT_TriggerableMoverUpdateStages, STATGROUP_Components);
 
 /*
 	TODO:
-	- Fix rotation velocity as it's still a bit fast and inverted from location velocity (loc = higher -> slow; rot = higher -> faster)
-	- Delegates where TODOs are flagged
 	- Permit a rotation to loop forever
 		- Need to flag the Quat rotation on the stage
 		- Disallow any other rotations to occur when FQuat is flagged
 		- Continue rotating on those axes indefinitely
 */
 
+namespace TriggerableMover
+{
+	/// @brief Ticks the mover until it stops needing updates
+	/// @return Whether or not the mover settled within MaxSteps
+	static bool Settle(UTriggerableMover* Mover, float DeltaTime, int32 MaxSteps)
+	{
+		for (int32 Step = 0; Step < MaxSteps && Mover->NeedsUpdate(); Step++)
+		{
+			Mover->TickMover<EStageEasing::Linear>(DeltaTime);
+		}
+
+		return !Mover->NeedsUpdate();
+	}
+
+	/// @brief Drives a scratch mover through random Trigger/Reverse toggles and uneven ticks
+	/// @remark Checks the state invariants after every step and that the mover settles once toggling stops
+	static FAutoConsoleCommandWithWorldAndArgs FuzzCommand(
+		TEXT("trigger.FuzzMover"),
+		TEXT("Drives a scratch mover through [Iterations = 1000000] random Trigger/Reverse/tick steps from [Seed = 0], reporting invariant violations, stalls and transitions per second."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (World == nullptr || !World->HasBegunPlay())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("trigger.FuzzMover needs a world that has begun play"));
+				return;
+			}
+
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000000;
+			FRandomStream Random(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0);
+
+			// How often toggling pauses to require the mover to settle, and how long it gets (one minute at 60Hz)
+			constexpr int32 SettleInterval = 1000;
+			constexpr int32 MaxSettleSteps = 3600;
+			constexpr float DeltaTime = 1.0 / 60.0;
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			USceneComponent* Root = NewObject<USceneComponent>(Actor);
+			Actor->SetRootComponent(Root);
+			Root->RegisterComponent();
+
+			UTriggerableMover* Mover = NewObject<UTriggerableMover>(Actor);
+			Mover->RegisterComponent();
+			Mover->SetSequence({
+				FSequenceStage(FStageLocation(FVector(200.0, 0.0, 0.0), 0.5, true, 0.25), FStageRotation(0.0, 90.0, 0.0, 0.5, true, 0.25)),
+				FSequenceStage(FStageLocation(FVector(0.0, 0.0, 150.0), 0.75, false), FStageRotation(0.0, 0.0, 0.0, 0.75)),
+				FSequenceStage(FStageLocation(FVector(-100.0, 100.0, 0.0), 0.25, true, 0.5), FStageRotation(0.0, 270.0, 0.0, 0.25, true, 0.5)) });
+
+			int32 Transitions = 0;
+			int32 Violations = 0;
+			int32 Stalls = 0;
+			const double StartTime = FPlatformTime::Seconds();
+
+			for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+			{
+				// Mostly ticks of uneven length with flickering toggles in between
+				const int32 Action = Random.RandRange(0, 9);
+				if (Action == 0)
+				{
+					Mover->Trigger_Implementation();
+					Transitions++;
+				}
+				else if (Action == 1)
+				{
+					Mover->Reverse_Implementation();
+					Transitions++;
+				}
+				else
+				{
+					Mover->TickMover<EStageEasing::Linear>(DeltaTime * Random.FRandRange(0.1, 4.0));
+				}
+
+				Violations += Mover->CheckInvariants() ? 0 : 1;
+
+				if (Iteration % SettleInterval == SettleInterval - 1)
+				{
+					Stalls += Settle(Mover, DeltaTime, MaxSettleSteps) ? 0 : 1;
+					Violations += Mover->CheckInvariants() ? 0 : 1;
+				}
+			}
+
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+			Actor->Destroy();
+
+			UE_LOG(LogTemp, Log, TEXT("trigger.FuzzMover: %i iterations in %.3fs, %i transitions (%.0f/s), %i invariant violations, %i stalls"),
+				Iterations, Seconds, Transitions, Seconds > 0.0 ? Transitions / Seconds : 0.0, Violations, Stalls);
+		}));
+}
+
 // Sets default values for this component's properties
 UTriggerableMover::UTriggerableMover()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Updated in batches by UTriggerSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 // Called when the game starts
@@ -21,36 +117,121 @@ void UTriggerableMover::BeginPlay()
 {
 	Super::BeginPlay();
 
-	OriginLocation = CurrentLocationTarget = PreviousLocationTarget = GetOwner()->GetActorLocation();
-	OriginRotation = GetOwner()->GetActorQuat();
-
-	CurrentRotationTarget = PreviousRotationTarget = OriginRotation;
-
+	// Stages are baked once initialized, so sequences set before then are only copied
 	OriginSequenceStage = FSequenceStage(
 		FStageLocation(FVector::Zero(), OriginLocationReturnVelocity), 
 		FStageRotation(FVector::Zero(), OriginRotationReturnVelocity));
+	OriginSequenceStage.HoldTime = OriginHoldTime;
 	AddStageToSequence(OriginSequenceStage);
+
+	TriggerSubsystem = GetWorld()->GetSubsystem<UTriggerSubsystem>();
+	if (TriggerSubsystem)
+	{
+		TriggerSubsystem->RegisterMover(this);
+		TriggerSubsystem->QueueInitialization(this);
+	}
+	else
+	{
+		InitializeMover();
+	}
 }
 
-// Called every frame
-void UTriggerableMover::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UTriggerableMover::InitializeMover()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	bInitialized = true;
+
+	OriginLocation = CurrentLocationTarget = PreviousLocationTarget = GetMoverLocation();
+	OriginRotation = StageStartRotation = GetMoverRotation();
+
+	// Count the movers this one rides on, once per actor in the attachment chain
+	HierarchyDepth = 0;
+	const AActor* Rider = GetOwner();
+	for (const USceneComponent* Parent = GetOwner()->GetRootComponent() ? GetOwner()->GetRootComponent()->GetAttachParent() : nullptr; Parent; Parent = Parent->GetAttachParent())
+	{
+		const AActor* ParentActor = Parent->GetOwner();
+		if (ParentActor && ParentActor != Rider)
+		{
+			Rider = ParentActor;
+			HierarchyDepth += ParentActor->FindComponentByClass<UTriggerableMover>() ? 1 : 0;
+		}
+	}
+
+	if (TriggerSubsystem)
+	{
+		TriggerSubsystem->InvalidateMoverOrder();
+	}
+
+	BakeStages(0);
+}
+
+// Called when the game ends
+void UTriggerableMover::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelHold();
+
+	if (TriggerSubsystem)
+	{
+		TriggerSubsystem->UnregisterMover(this);
+		TriggerSubsystem = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+template<EStageEasing Easing>
+void UTriggerableMover::TickMover(const float DeltaTime)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	if (bActive)
 	{
-		MoveAndRotate(DeltaTime, bIsReversing);
+		LoopClock += DeltaTime;
+		MoveAndRotate<Easing>(DeltaTime, bIsReversing);
 	}
+
+#if DO_CHECK
+	CheckInvariants();
+#endif
+}
+
+bool UTriggerableMover::CheckInvariants() const
+{
+	const bool bStageValid = Sequence.Num() == 0 || Sequence.IsValidIndex(StageIndex);
+	const bool bDirectionValid = !(bHasTriggered && bIsReversing);
+	const bool bCompletionValid = !bHasCompleted || StageIndex == 0 || StageIndex == Sequence.Num() - 1;
+	const bool bProgressValid = StageElapsed >= 0.0 && StageDistance >= 0.0 && StageAngle >= 0.0 && FMath::IsFinite(StageAngle);
+	const bool bHoldValid = bHolding == HoldTimer.IsValid();
+
+	return ensureMsgf(bStageValid && bDirectionValid && bCompletionValid && bProgressValid && bHoldValid,
+		TEXT("%s: inconsistent mover state (stage %i of %i, triggered %i, reversing %i, completed %i, elapsed %f, distance %f)"),
+		*GetName(), StageIndex, Sequence.Num(), bHasTriggered, bIsReversing, bHasCompleted, StageElapsed, StageDistance);
 }
 
+
 #pragma region Sequence Setting
 void UTriggerableMover::AppendSequenceStages(TArray<FSequenceStage> const &SequenceStages)
 {
+	LLM_SCOPE_BYTAG(Components);
+	const SIZE_T AllocatedSize = Sequence.GetAllocatedSize();
+	const int32 FirstIndex = Sequence.Num();
 	Sequence.Append(SequenceStages);
+	TRACK_COMPONENT_ALLOCATION(Sequence, AllocatedSize);
+
+	BakeStages(FirstIndex);
 }
 
 void UTriggerableMover::AddStageToSequence(FSequenceStage const &SequenceStage)
 {
+	LLM_SCOPE_BYTAG(Components);
+	const SIZE_T AllocatedSize = Sequence.GetAllocatedSize();
+	const int32 FirstIndex = Sequence.Num();
 	Sequence.Add(SequenceStage);
+	TRACK_COMPONENT_ALLOCATION(Sequence, AllocatedSize);
+
+	BakeStages(FirstIndex);
 }
 
 void UTriggerableMover::SetSequence(TArray<FSequenceStage> const &SequenceStages)
@@ -59,22 +240,123 @@ void UTriggerableMover::SetSequence(TArray<FSequenceStage> const &SequenceStages
 	Sequence.Add(OriginSequenceStage);
 	AppendSequenceStages(SequenceStages);
 }
+
+void UTriggerableMover::BakeStages(int32 FirstIndex)
+{
+	// A changed sequence takes a different time to loop
+	LoopPeriod = 0.0;
+	LoopCycleStart = -1.0;
+
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(Components);
+
+	for (int32 Index = FirstIndex; Index < Sequence.Num(); Index++)
+	{
+		Sequence[Index].Location.BakePath();
+		Sequence[Index].Location.BakeEasing();
+		Sequence[Index].Rotation.BakeEasing();
+		Sequence[Index].Rotation.BakeRotation();
+	}
+}
 #pragma endregion
 
+void UTriggerableMover::SerializeMoverState(FArchive& Ar)
+{
+	InitializeMover();
+
+	// Pack the flags into a single byte
+	uint8 Flags = (bActive ? 1 : 0) | (bHasTriggered ? 2 : 0) | (bIsReversing ? 4 : 0) | (bHasCompleted ? 8 : 0);
+	Ar << Flags;
+
+	bActive = (Flags & 1) != 0;
+	bHasTriggered = (Flags & 2) != 0;
+	bIsReversing = (Flags & 4) != 0;
+	bHasCompleted = (Flags & 8) != 0;
+
+	uint32 PackedStageIndex = StageIndex;
+	Ar.SerializeIntPacked(PackedStageIndex);
+	StageIndex = PackedStageIndex;
+
+	Ar << CurrentLocationTarget << PreviousLocationTarget;
+	Ar << StageStartRotation;
+	Ar << StageAngle;
+	Ar << StageDistance;
+	Ar << StageElapsed;
+
+	FVector Location = GetMoverLocation();
+	FQuat Rotation = GetMoverRotation();
+	Ar << Location << Rotation;
+
+	// Holds are not saved; a restored mover that was holding waits out the hold again from the start
+	if (Ar.IsLoading())
+	{
+		CancelHold();
+		bHoldServed = false;
+		LoopCycleStart = -1.0;
+		StageIndex = FMath::Clamp(StageIndex, 0, FMath::Max(Sequence.Num() - 1, 0));
+		SetMoverLocation(Location, ETeleportType::TeleportPhysics);
+		SetMoverRotation(Rotation);
+	}
+}
+
 void UTriggerableMover::Activate_Implementation()
 {
 	bActive = true;
 
-	// TODO: Event Dispatcher OnActivated
+	QueueMoverEvent(EMoverEvent::Activated);
 }
 
 void UTriggerableMover::Deactivate_Implementation()
 {
 	bActive = false;
 
-	// TODO: Event Dispatcher OnDeactivated
+	QueueMoverEvent(EMoverEvent::Deactivated);
+}
+
+#pragma region Transform
+FVector UTriggerableMover::GetMoverLocation() const
+{
+	const USceneComponent* Root = GetOwner()->GetRootComponent();
+	return bRelativeToParent && Root ? Root->GetRelativeLocation() : GetOwner()->GetActorLocation();
+}
+
+FQuat UTriggerableMover::GetMoverRotation() const
+{
+	// The relative transform reads the component's cached quaternion rather than converting the rotator
+	const USceneComponent* Root = GetOwner()->GetRootComponent();
+	return bRelativeToParent && Root ? Root->GetRelativeTransform().GetRotation() : GetOwner()->GetActorQuat();
 }
 
+void UTriggerableMover::SetMoverLocation(const FVector& Location, ETeleportType Teleport)
+{
+	USceneComponent* Root = GetOwner()->GetRootComponent();
+	if (bRelativeToParent && Root)
+	{
+		Root->SetRelativeLocation(Location, false, nullptr, Teleport);
+		return;
+	}
+
+	GetOwner()->SetActorLocation(Location, false, nullptr, Teleport);
+}
+
+void UTriggerableMover::SetMoverRotation(const FQuat& Rotation)
+{
+	USceneComponent* Root = GetOwner()->GetRootComponent();
+	if (bRelativeToParent && Root)
+	{
+		Root->SetRelativeRotation(Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+		return;
+	}
+
+	GetOwner()->SetActorRotation(Rotation, ETeleportType::TeleportPhysics);
+}
+#pragma endregion
+
+template<EStageEasing Easing>
 void UTriggerableMover::MoveAndRotate(const float DeltaTime, bool bReverse)
 {
 	// Sequence is empty or this is in an untouched state
@@ -83,109 +365,161 @@ void UTriggerableMover::MoveAndRotate(const float DeltaTime, bool bReverse)
 		return;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_TriggerableMoverMoveAndRotate);
+	INC_DWORD_STAT(STAT_ActiveMovers);
+	CSV_CUSTOM_STAT(Components, ActiveMovers, 1, ECsvCustomStatOp::Accumulate);
+
 	// Current Actor State
-	FVector CurrentLocation = GetOwner()->GetActorLocation();
-	FRotator CurrentRotation = GetOwner()->GetActorRotation();
+	FVector CurrentLocation = GetMoverLocation();
+	FQuat CurrentRotation = GetMoverRotation();
 
 	// Update the stage and completion if we've reached stage destination
 	UpdateStages(CurrentLocation, CurrentRotation, bReverse);
 
 	// Current stage in sequence
-	FSequenceStage CurrentStage = Sequence[StageIndex];
+	const FSequenceStage& CurrentStage = Sequence[StageIndex];
 
 	// Only move if we have a non-zero FVector
-	Move(DeltaTime, CurrentLocation, CurrentStage.Location, bReverse);
-	Rotate(DeltaTime, CurrentRotation, CurrentStage.Rotation, bReverse);
+	Move<Easing>(DeltaTime, CurrentLocation, CurrentStage.Location, bReverse);
+	Rotate<Easing>(DeltaTime, CurrentStage.Rotation, bReverse);
+
+	StageElapsed += DeltaTime;
 }
 
+float UTriggerableMover::GetStageAlpha(const FStage &Stage, bool bReverse, const float DeltaTime) const
+{
+	// Stage velocities are the time taken to travel the stage
+	float Duration = bReverse && Stage.bIsReversible ? Stage.ReverseVelocity : Stage.ForwardVelocity;
+	return Duration > 0.0 ? (StageElapsed + DeltaTime * 0.5) / Duration : 1.0;
+}
+
+template<EStageEasing Easing>
 void UTriggerableMover::Move(const float DeltaTime, const FVector &CurrentLocation, const FStageLocation& StageLocation, bool bReverse)
 {
 
 	// Early return if location is done OR we're in reverse and location is not allowed to reverse
-	if ((CurrentLocationTarget - CurrentLocation).IsNearlyZero() || (bReverse && !StageLocation.bIsReversible))
+	if (IsLocationDone(CurrentLocation, StageLocation) || (bReverse && !StageLocation.bIsReversible))
 	{
 		return;
 	}
 
 	// Movement Speed
 	float DirectionSpeed = bReverse && StageLocation.bIsReversible ? StageLocation.ReverseVelocity : StageLocation.ForwardVelocity;
-	float Speed = StageLocation.Offset.Size() / DirectionSpeed;
+	float Speed = StageLocation.GetPathLength() / DirectionSpeed;
+
+	// Scale by the easing profile, using the bucket's specialized evaluator when the stage matches it
+	float Alpha = GetStageAlpha(StageLocation, bReverse, DeltaTime);
+	Speed *= StageLocation.Easing == Easing
+		? EvaluateStageEasing<Easing>(Alpha, StageLocation.EasingTable)
+		: StageLocation.EvaluateEasing(Alpha);
+
+	// Curved paths travel at constant speed along the baked arc-length table
+	if (StageLocation.IsCurved() && StageIndex != 0)
+	{
+		const double PathLength = StageLocation.PathTable.Length;
+		StageDistance = FMath::Min(StageDistance + Speed * DeltaTime, PathLength);
+
+		// Reversing walks the path backwards from its end, which is the current target
+		FVector PathStart = bReverse ? CurrentLocationTarget : CurrentLocationTarget - StageLocation.Offset;
+		double PathDistance = bReverse ? PathLength - StageDistance : StageDistance;
+
+		FVector PathLocation = StageDistance >= PathLength ? CurrentLocationTarget : PathStart + StageLocation.PathTable.Sample(PathDistance);
+		SetMoverLocation(PathLocation);
+		return;
+	}
 
 	FVector InterpLocation = FMath::VInterpConstantTo(CurrentLocation, CurrentLocationTarget, DeltaTime, Speed);
-	GetOwner()->SetActorLocation(InterpLocation);
+	SetMoverLocation(InterpLocation);
 }
 
-void UTriggerableMover::Rotate(const float DeltaTime, const FRotator &CurrentRotation, const FStageRotation& StageRotation, bool bReverse)
+template<EStageEasing Easing>
+void UTriggerableMover::Rotate(const float DeltaTime, const FStageRotation& StageRotation, bool bReverse)
 {
 	bool bReversePermitted = bForceReverseSequence || StageRotation.bIsReversible;
 
-	if (RotationRemaining.IsZero() || (bReverse && !bReversePermitted))
+	if (IsRotationDone(bReverse) || (bReverse && !bReversePermitted))
 	{
 		return;
 	}
 
-	// Retrieve the correction direction based on if the sequence is reversing and the stage rotation is allowed to reverse
-	float DirectionSpeed = bReverse && StageRotation.bIsReversible ? StageRotation.ReverseVelocity : StageRotation.ForwardVelocity;
-	float Speed = StageRotation.Offset.Size() / (DirectionSpeed / DeltaTime);
+	// Stage velocities are the time taken to travel the stage, same as locations
+	float Duration = bReverse && StageRotation.bIsReversible ? StageRotation.ReverseVelocity : StageRotation.ForwardVelocity;
+	double MaxStep = StageRotation.BakedAngle;
+	if (Duration > 0.0)
+	{
+		// Same as locations, the bucket's specialized evaluator is used when the stage matches it
+		float Alpha = GetStageAlpha(StageRotation, bReverse, DeltaTime);
+		MaxStep *= DeltaTime / Duration * (StageRotation.Easing == Easing
+			? EvaluateStageEasing<Easing>(Alpha, StageRotation.EasingTable)
+			: StageRotation.EvaluateEasing(Alpha));
+	}
 
-	FQuat CurrentQuat = CurrentRotation.Quaternion();	
-	FQuat InterpQuat = FMath::QInterpConstantTo(CurrentQuat, CurrentRotationTarget, DeltaTime, Speed);
-	
-	// Apply InterpQuat (Current + interval to target) first, and then the inverse of current to get delta
-	FQuat DeltaQuat = InterpQuat * CurrentQuat.Inverse();
+	// The rotation is always rebuilt from the start of the stage, so it never drifts or wraps at 360 degrees
+	StageAngle = MoverMath::StepAngleTo(StageAngle, bReverse ? 0.0 : StageRotation.BakedAngle, MaxStep);
+	SetMoverRotation(StageStartRotation * FQuat(StageRotation.BakedAxis, StageAngle));
+}
 
-	// Soley compare to zero as values can be positive or negative depending on user input
-	FVector Delta = DeltaQuat.Euler();
-	RotationRemaining.X = RotationRemaining.X == 0.0 ? 0.0 : RotationRemaining.X - Delta.X;
-	RotationRemaining.Y = RotationRemaining.Y == 0.0 ? 0.0 : RotationRemaining.Y - Delta.Y;
-	RotationRemaining.Z = RotationRemaining.Z == 0.0 ? 0.0 : RotationRemaining.Z - Delta.Z;
+bool UTriggerableMover::IsRotationDone(bool bReverse) const
+{
+	return bReverse ? StageAngle <= 0.0 : StageAngle >= Sequence[StageIndex].Rotation.BakedAngle;
+}
 
-	// Next step will land in the negative, so zero out and use the difference as the remaining interpolated rotation
-	if (RotationRemaining.IsNearlyZero())
+bool UTriggerableMover::IsLocationDone(const FVector& CurrentLocation, const FStageLocation& StageLocation) const
+{
+	if (StageLocation.IsCurved() && StageIndex != 0)
 	{
-		RotationRemaining = FVector::Zero();
-		GetOwner()->SetActorRotation(CurrentRotationTarget, ETeleportType::TeleportPhysics);
+		return StageDistance >= StageLocation.PathTable.Length;
 	}
 
-	// TODO: World Rotation appears to flip once it reaches 360 degrees
-	// GetOwner()->SetActorRotation(InterpQuat)
-	GetOwner()->AddActorWorldRotation(DeltaQuat, false, nullptr, ETeleportType::TeleportPhysics);
+	return (CurrentLocationTarget - CurrentLocation).IsNearlyZero();
 }
 
-void UTriggerableMover::UpdateStages(const FVector &CurrentLocation, const FRotator &CurrentRotation, bool bReverse)
+void UTriggerableMover::UpdateStages(const FVector &CurrentLocation, const FQuat &CurrentRotation, bool bReverse)
 {
+	SCOPE_CYCLE_COUNTER(STAT_TriggerableMoverUpdateStages);
+
 	int32 Direction = bReverse ? -1 : 1;
+	const FSequenceStage& Stage = Sequence[StageIndex];
+
+	// Parts of a stage that are not reversible are skipped when reversing, rather than waited on forever
+	const bool bSkipLocation = bReverse && !Stage.Location.bIsReversible;
 
-	// Check the rotation overflow still needed and return without changing stages
-	if (CurrentRotationTarget.Equals(CurrentRotation.Quaternion()) && !RotationRemaining.IsZero())
+	// A skipped rotation is measured from where the actor is, so turning forward again rotates the whole stage
+	if (bReverse && !bForceReverseSequence && !Stage.Rotation.bIsReversible && StageAngle > 0.0)
 	{
-		// Add the next step in the rotation, broken up into 180 degree capped chunks only if necessary
-		FQuat Step = TrackRotationStep(RotationRemaining, RotationStep, RotationTolerance) * Direction;
-		CurrentRotationTarget = CurrentRotation.Quaternion() * Step * Direction;
+		StageStartRotation = CurrentRotation;
+		StageAngle = 0.0;
 	}
 
 	// We've reached our destination and no rotation remaining, so increment/decrement stage
-	if ((CurrentLocationTarget - CurrentLocation).IsNearlyZero() && RotationRemaining.IsZero())
+	if ((bSkipLocation || IsLocationDone(CurrentLocation, Stage.Location)) && IsRotationDone(bReverse))
 	{
-		// Update index and ensure we don't move outside of the Array boundaries
-		StageIndex += Direction;
-		StageIndex = FMath::Clamp(StageIndex, 0, Sequence.Num() - 1);
+		// The last stage (or stage 1 when reversing) completes the sequence once it has been travelled
+		const bool bCompletes = MoverMath::IsSequenceComplete(StageIndex, bReverse, Sequence.Num());
 
-		// TODO: Event Dispatcher on bHasCompleted if bHasCompleted == true and we reside at the stage location/rotation
-		bHasCompleted = bReverse ? StageIndex == 0 : StageIndex == Sequence.Num() - 1;
+		// Sleep at the stage end before moving on. A sequence that stops at its end has nothing to wait for.
+		if (!bHoldServed && (!bCompletes || bLoopForever) && StartHold(GetArrivalHoldTime(bReverse)))
+		{
+			return;
+		}
+
+		bHasCompleted = bCompletes;
+
+		// Update index and ensure we don't move outside of the Array boundaries
+		StageIndex = MoverMath::AdvanceStage(StageIndex, Direction, Sequence.Num());
 
 		if (bHasCompleted)
 		{
+			QueueMoverEvent(EMoverEvent::Completed);
 			Loop();
 			return;
 		}
 
-		UE_LOG(LogTemp, Warning, TEXT("--- Setting Targets ---"));
 		SetStageTargets(CurrentLocation, CurrentRotation, Direction);
 	}
 }
 
-void UTriggerableMover::SetStageTargets(const FVector &CurrentLocation, const FRotator &CurrentRotation, const int32 Direction)
+void UTriggerableMover::SetStageTargets(const FVector &CurrentLocation, const FQuat &CurrentRotation, const int32 Direction)
 {
 	if (Direction != 1 && Direction != -1)
 	{
@@ -193,73 +527,35 @@ void UTriggerableMover::SetStageTargets(const FVector &CurrentLocation, const FR
 	}
 
 	PreviousLocationTarget = CurrentLocationTarget;
-	PreviousRotationTarget = CurrentRotationTarget;
+	StageDistance = 0.0;
+	StageElapsed = 0.0;
+	bHoldServed = false;
 
-	RotationRemaining = Sequence[StageIndex].Rotation.ToVector();
-
-	// Need to modify -- Axes values should never be higher than the
-	RotationRemaining.X = RotationRemaining.X == 0.0 ? 0.0 : RotationRemaining.X;
-	RotationRemaining.Y = RotationRemaining.Y == 0.0 ? 0.0 : RotationRemaining.Y;
-	RotationRemaining.Z = RotationRemaining.Z == 0.0 ? 0.0 : RotationRemaining.Z;
+	const FStageRotation& StageRotation = Sequence[StageIndex].Rotation;
 
 	// Set the targets
 	if (StageIndex == 0)
 	{
 		// Origin return
 		CurrentLocationTarget = OriginLocation;
-		CurrentRotationTarget = OriginRotation;
-		UE_LOG(LogTemp, Warning, TEXT("-- Starting Origin Target: %s"), *CurrentRotationTarget.Rotator().ToCompactString());
-	}
-	else
-	{
-		CurrentLocationTarget = CurrentLocation + (Sequence[StageIndex].Location.Offset * Direction);
-
-		FQuat Step = TrackRotationStep(RotationRemaining, RotationStep, RotationTolerance);
-		CurrentRotationTarget *= Step * Direction;
-		
-		//CurrentRotationTarget = UKismetMathLibrary::Quat_MakeFromEuler(RotationRemaining) * Direction;
+		StageStartRotation = OriginRotation;
+		StageAngle = 0.0;
 	}
-
-	// TODO: Event Dispatcher on StageUpdated
-}
-
-void UTriggerableMover::AdjustRemainingRotation(const FVector &ReductionAmount)
-{
-	RotationRemaining.X = FMath::Max(RotationRemaining.X - ReductionAmount.X, 0.0);
-	RotationRemaining.Y = FMath::Max(RotationRemaining.Y - ReductionAmount.Y, 0.0);
-	RotationRemaining.Z = FMath::Max(RotationRemaining.Z - ReductionAmount.Z, 0.0);
-}
-
-FQuat UTriggerableMover::TrackRotationStep(const FVector &RemainingRotation, const int32 StepInterval, const double Tolerance)
-{
-	double Pitch = TrackRotationForce(RemainingRotation.Y, StepInterval, Tolerance);
-	double Yaw = TrackRotationForce(RemainingRotation.Z, StepInterval, Tolerance);
-	double Roll = TrackRotationForce(RemainingRotation.X, StepInterval, Tolerance);
-
-	UE_LOG(LogTemp, Warning, TEXT("Pitch, Yaw, and Roll for stage %i: %f, %f, %f"), StageIndex, Pitch, Yaw, Roll);
-
-	return FRotator(Pitch, Yaw, Roll).Quaternion();
-}
-
-float UTriggerableMover::TrackRotationForce(const double TrackedForce, const int32 StepInterval, const double Tolerance)
-{
-	// Between zero and rotation tolerance range
-    if (FMath::Abs(TrackedForce) <= Tolerance)
+	else if (Direction > 0)
 	{
-		return Tolerance;
+		CurrentLocationTarget = CurrentLocation + Sequence[StageIndex].Location.Offset;
+		StageStartRotation = CurrentRotation;
+		StageAngle = 0.0;
 	}
-
-	// Tracked value is same as step interval, so this is last step
-	if (FMath::Abs(TrackedForce - StepInterval) <= Tolerance)
+	else
 	{
-		return TrackedForce;
+		// Reversing enters the stage at its end and rotates back to its start
+		CurrentLocationTarget = CurrentLocation - Sequence[StageIndex].Location.Offset;
+		StageStartRotation = CurrentRotation * StageRotation.BakedQuat.Inverse();
+		StageAngle = StageRotation.BakedAngle;
 	}
 
-	// Check if remainder of mod is non-zero from 180 degree step. If zero, we know interval is factor of step, so subtract
-	double Modulus = std::fmod(TrackedForce, StepInterval);
-	double Interval = FMath::Min(TrackedForce - StepInterval, StepInterval);
-	
-	return Modulus == 0.0 ? Interval : Modulus;
+	QueueMoverEvent(EMoverEvent::StageUpdated);
 }
 
 void UTriggerableMover::Trigger_Implementation()
@@ -270,52 +566,154 @@ void UTriggerableMover::Trigger_Implementation()
 		return;
 	}
 
-	// We are coming from a reverse state, so target index should be the next one
-	if (bIsReversing)
-	{
-		StageIndex = FMath::Clamp(StageIndex++, 0, Sequence.Num() - 1);
-
-		// Movment should be
-		CurrentLocationTarget = Sequence[StageIndex].Location.Offset;
+	InitializeMover();
+	CancelHold();
 
-		// Calculate the traveled rotation and set the target to the inverse of that travel
-		RotationRemaining = Sequence[StageIndex].Rotation.ToVector() - RotationRemaining;
-		CurrentRotationTarget = UKismetMathLibrary::Quat_MakeFromEuler(-RotationRemaining);
+	// We are coming from a reverse state part way through a stage, so travel that stage forward again.
+	// A completed reverse is back at the origin and starts from the first stage as usual.
+	const bool bFromRest = !bIsReversing || bHasCompleted;
+	if (!bFromRest)
+	{
+		FlipDirection();
 	}
 
+	// Loops are timed from the origin; turning back part way through leaves the current loop untimed
+	LoopCycleStart = bFromRest ? LoopClock : -1.0;
+
 	bHasTriggered = true;
 	bIsReversing = false;
 	bHasCompleted = false;
+	bHoldServed = false;
+
+	// The start delay staggers external triggers only; a loop has already held at the origin
+	if (bFromRest && !bLooping)
+	{
+		StartHold(StartDelay);
+	}
 
-	// TODO: Event Dispatcher for OnTriggered
+	QueueMoverEvent(EMoverEvent::Triggered);
 }
 
 void UTriggerableMover::Reverse_Implementation()
 {
-
 	// Ignore if we there is no sequence or already reversing
 	if (Sequence.Num() == 0 || bIsReversing || !bActive)
 	{
 		return;
 	}
 
+	InitializeMover();
+	CancelHold();
+
+	// Travel the current stage back to where it started, including the last stage of a completed sequence
 	if (bHasTriggered)
 	{
-		StageIndex = FMath::Clamp(StageIndex--, 0, Sequence.Num() - 1);
-		CurrentLocationTarget = Sequence[StageIndex].Location.Offset;
-
-		// Calculate the traveled rotation and set the target to the inverse of that travel
-		RotationRemaining = Sequence[StageIndex].Rotation.ToVector() - RotationRemaining;
-		CurrentRotationTarget = UKismetMathLibrary::Quat_MakeFromEuler(-RotationRemaining);
+		FlipDirection();
 	}
 
-	RotationRemaining = Sequence[StageIndex].Rotation.ToVector() - RotationRemaining;
+	// Only turning back at the end of the sequence keeps the current loop timed
+	if (!bHasCompleted)
+	{
+		LoopCycleStart = -1.0;
+	}
 
 	bHasTriggered = false;
 	bIsReversing = true;
 	bHasCompleted = false;
+	bHoldServed = false;
+
+	QueueMoverEvent(EMoverEvent::Reversed);
+}
+
+void UTriggerableMover::FlipDirection()
+{
+	FlipStageProgress();
+
+	// The stage index stays the same; only the end we are heading for changes.
+	// The rotation is measured from the start of the stage either way, so it simply counts back.
+	Swap(CurrentLocationTarget, PreviousLocationTarget);
+}
+
+void UTriggerableMover::FlipStageProgress()
+{
+	const FStageLocation& StageLocation = Sequence[StageIndex].Location;
+	// Progress is measured in the direction of travel, so a stage not yet started is already finished the other way
+	if (StageLocation.IsCurved())
+	{
+		StageDistance = StageLocation.PathTable.Length - StageDistance;
+	}
+
+	// Mirror the elapsed time so eased stages resume from the matching point of the profile
+	if (StageElapsed > 0.0)
+	{
+		float Duration = bIsReversing ? StageLocation.ForwardVelocity : StageLocation.ReverseVelocity;
+		float PreviousDuration = bIsReversing ? StageLocation.ReverseVelocity : StageLocation.ForwardVelocity;
+		float Alpha = PreviousDuration > 0.0 ? FMath::Clamp(StageElapsed / PreviousDuration, 0.0f, 1.0f) : 1.0f;
+		StageElapsed = (1.0 - Alpha) * Duration;
+	}
+}
+
+#pragma region Holds
+bool UTriggerableMover::StartHold(float HoldTime)
+{
+	if (HoldTime <= 0.0 || TriggerSubsystem == nullptr)
+	{
+		return false;
+	}
+
+	bHolding = true;
+	HoldTimer = TriggerSubsystem->ScheduleMoverWake(HoldTime, this);
+	HoldEndTime = TriggerSubsystem->GetTriggerTimerTime() + HoldTime;
+	return true;
+}
+
+void UTriggerableMover::CancelHold()
+{
+	if (bHolding && TriggerSubsystem)
+	{
+		TriggerSubsystem->CancelTriggerTimer(HoldTimer);
+	}
 
-	// TODO: Event Dispatcher for OnReversed
+	bHolding = false;
+	HoldTimer.Invalidate();
+}
+
+void UTriggerableMover::OnHoldExpired(const FTimerWheelHandle& Handle, float DeltaTime)
+{
+	if (!(Handle == HoldTimer))
+	{
+		return;
+	}
+
+	// Picked up by the batched update this frame, which moves on from the stage end.
+	// The wheel fires on its first tick at or after the hold ends, and the update applies the whole frame, so
+	// owe the mover exactly the time since the hold ended. Late wakes carry the difference into the next stage.
+	const double SinceHoldEnd = FMath::Max(TriggerSubsystem->GetTriggerTimerTime() - HoldEndTime, 0.0);
+	Significance.PendingTime = SinceHoldEnd - DeltaTime;
+	bHolding = false;
+	bHoldServed = true;
+	HoldTimer.Invalidate();
+}
+
+float UTriggerableMover::GetArrivalHoldTime(bool bReverse) const
+{
+	// Forward arrives at the end of the current stage; reverse arrives at the end of the stage before it.
+	// Travelling forward through the origin stage is only the start of the sequence, so it never holds.
+	if (bReverse)
+	{
+		return StageIndex > 0 ? Sequence[StageIndex - 1].HoldTime : 0.0;
+	}
+
+	return StageIndex > 0 ? Sequence[StageIndex].HoldTime : 0.0;
+}
+#pragma endregion
+
+void UTriggerableMover::QueueMoverEvent(EMoverEvent Event)
+{
+	if (TriggerSubsystem)
+	{
+		TriggerSubsystem->QueueMoverEvent(this, Event, StageIndex);
+	}
 }
 
 void UTriggerableMover::Loop()
@@ -324,17 +722,32 @@ void UTriggerableMover::Loop()
 	{
 		return;
 	}
-	
-	bHasCompleted = false;
 
-	// TODO: Event Dispatcher for OnLooped
+	// Trigger/Reverse clear the completion once they have seen it
+	QueueMoverEvent(EMoverEvent::Looped);
 
 	if (bIsReversing)
 	{
+		// Back at the origin, so a loop that was timed from the origin is complete
+		if (LoopCycleStart >= 0.0)
+		{
+			LoopPeriod = LoopClock - LoopCycleStart;
+		}
+
+		TGuardValue<bool> LoopingGuard(bLooping, true);
 		Trigger_Implementation();
 	}
 	else if (bHasTriggered)
 	{
 		Reverse_Implementation();
 	}
-}
\ No newline at end of file
+}
+
+// Batched update entry points, one per easing bucket
+template void UTriggerableMover::TickMover<EStageEasing::Linear>(const float DeltaTime);
+template void UTriggerableMover::TickMover<EStageEasing::SmoothStep>(const float DeltaTime);
+template void UTriggerableMover::TickMover<EStageEasing::EaseIn>(const float DeltaTime);
+template void UTriggerableMover::TickMover<EStageEasing::EaseOut>(const float DeltaTime);
+template void UTriggerableMover::TickMover<EStageEasing::EaseInOut>(const float DeltaTime);
+template void UTriggerableMover::TickMover<EStageEasing::Spring>(const float DeltaTime);
+template void UTriggerableMover::TickMover<EStageEasing::Curve>(const float DeltaTime);
@@ -5,8 +5,13 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "MovementRotation/SequenceStage.h"
 #include "ITriggerable.h"
+#include "MoverEvents.h"
+#include "MoverSignificance.h"
+#include "TimerWheel.h"
 #include "TriggerableMover.generated.h"
 
+class UTriggerSubsystem;
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class MPSTARTER_API UTriggerableMover : public UActorComponent, public IITriggerable
 {
@@ -16,7 +21,59 @@ public:
 	// Sets default values for this component's properties
 	UTriggerableMover();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	/// @brief Performs this frame's movement and rotation. Called by UTriggerSubsystem's batched update.
+	/// @tparam Easing Easing bucket the mover was sorted into
+	/// @param DeltaTime Time difference between frame changes
+	template<EStageEasing Easing>
+	void TickMover(const float DeltaTime);
+
+	/// @brief Whether or not the mover has movement or rotation to perform
+	bool NeedsUpdate() const
+	{
+		return bInitialized && bActive && !bHolding && Sequence.Num() > 0 && (bHasTriggered || bIsReversing) && (!bHasCompleted || bLoopForever);
+	}
+
+	/// @brief Whether or not the mover is sleeping through a stage hold or start delay
+	bool IsHolding() const { return bHolding; }
+
+	/// @brief Wakes the mover from a hold. Called by UTriggerSubsystem when the hold's timer comes due.
+	/// @param Handle Handle of the timer
+	/// @param DeltaTime Time the timer wheel was turned by this frame, which the batched update goes on to apply
+	void OnHoldExpired(const FTimerWheelHandle& Handle, float DeltaTime);
+
+	/// @brief Checks that the sequence state is consistent, raising an ensure if not
+	/// @return Whether or not the state is consistent
+	bool CheckInvariants() const;
+
+	/// @brief Reads the origin transform and bakes the sequence. Does nothing once initialized.
+	/// @remark Called by UTriggerSubsystem's time-sliced initialization queue, or on first use if that comes sooner
+	void InitializeMover();
+
+	/// @brief Number of movers this one rides on through its attachment chain, read on initialization
+	/// @remark UTriggerSubsystem updates shallower movers first so parents have moved before their children
+	int32 GetHierarchyDepth() const { return HierarchyDepth; }
+
+	/// @brief Easing profile of the current stage, used to bucket the batched update
+	/// @remark The movement's profile, or the rotation's when the movement is linear, so rotation-only easing also
+	///	gets the specialized evaluator. A stage easing both with different profiles evaluates its rotation at runtime.
+	EStageEasing GetEasingBucket() const
+	{
+		const FSequenceStage& Stage = Sequence[StageIndex];
+		return Stage.Location.Easing != EStageEasing::Linear ? Stage.Location.Easing : Stage.Rotation.Easing;
+	}
+
+	/// @brief Update tier and skipped time, managed by UTriggerSubsystem
+	FMoverSignificance Significance;
+
+	/// @brief Mover time (s) of one full loop there and back, as last measured. Zero until a loop has been timed.
+	/// @remark Holds are waited out on the timer wheel rather than in mover time, so they are not included
+	float GetLoopPeriod() const { return LoopPeriod; }
+
+	/// @brief Raised at the end of the frame for every lifecycle event of this mover
+	/// @remark Events are only queued for Blueprint delivery while something is bound
+	UPROPERTY(BlueprintAssignable, Category = "Triggerable")
+	FOnTriggerableMoverEvent OnMoverEvent;
+
 	/// @brief  Activates the mover, starting it from its current point in the sequence
 	void Activate_Implementation();
 
@@ -64,10 +121,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Triggerable Sequence", meta = (DisplayName = "Set Triggerable Sequence", CompactNodeTitle = "SETTRIGSEQ", ArrayParam = "SequenceArray"))
 	void SetSequence(TArray<FSequenceStage> const &SequenceStages);
 
+	/// @brief Saves or restores the sequence cursor state and owner transform
+	/// @remark Restoring keeps the origin read on initialization. The origin and sequence must be unchanged since the save.
+	/// @param Ar Archive to write to or read from
+	void SerializeMoverState(FArchive& Ar);
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 
 #pragma region Members
@@ -84,6 +149,17 @@ private:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Triggerable", meta=(AllowPrivateAccess = "true"))
 	bool bLoopForever = false;
 
+	/// @brief Whether or not to animate the transform relative to the attach parent instead of in world space
+	/// @remark For movers riding other movers (a lift on a turntable). Stage offsets are then in the parent's space
+	/// and the attachment carries the mover along with its parent.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Triggerable", meta=(AllowPrivateAccess = "true"))
+	bool bRelativeToParent = false;
+
+	/// @brief Time (s) to wait after being triggered from rest before the sequence starts
+	/// @remark Useful for staggering movers triggered together. Loops are not delayed again.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Triggerable", meta=(AllowPrivateAccess = "true", ClampMin = "0", Units = "s"))
+	float StartDelay = 0.0;
+
 #pragma region Origin
 	/// @brief Origin Location Return (Reverse) Speed
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Triggerable | Origin Sequence Stage", meta=(AllowPrivateAccess = "true"))
@@ -93,10 +169,17 @@ private:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Triggerable | Origin Sequence Stage", meta=(AllowPrivateAccess = "true"))
 	float OriginRotationReturnVelocity = 1.0;
 
+	/// @brief Time (s) to wait back at the origin before looping forward again
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Triggerable | Origin Sequence Stage", meta=(AllowPrivateAccess = "true", ClampMin = "0", Units = "s"))
+	float OriginHoldTime = 0.0;
+
 	/// @brief Origin sequence stage. Gets created on begin play.
 	FSequenceStage OriginSequenceStage;
 #pragma endregion
 	
+	/// @brief Whether or not InitializeMover has run
+	bool bInitialized = false;
+
 	/// @brief Whether or not this triggerable has been triggered
 	bool bHasTriggered = false;
 
@@ -109,13 +192,33 @@ private:
 	/// @brief Current index of the stage of movement/rotation
 	int32 StageIndex = 0;
 
-#pragma region Rotation
-	/// @brief Rotation tolerance to evaluate when a rotation is completed
-	double RotationTolerance = 0.000001;
+	/// @brief Movers this one rides on through its attachment chain
+	int32 HierarchyDepth = 0;
+
+	/// @brief Whether or not the mover is sleeping until HoldTimer comes due
+	bool bHolding = false;
+
+	/// @brief Whether or not the hold at the end of the current stage has been waited out
+	bool bHoldServed = false;
+
+	/// @brief Whether or not Loop is re-triggering the mover, which already held at the origin and skips StartDelay
+	bool bLooping = false;
+
+	/// @brief Mover time (s) advanced so far, used to time loops
+	double LoopClock = 0.0;
+
+	/// @brief LoopClock when the current loop left the origin, or negative if the loop was interrupted
+	double LoopCycleStart = -1.0;
+
+	/// @brief Mover time (s) of one full loop, see GetLoopPeriod
+	float LoopPeriod = 0.0;
+
+	/// @brief Wake scheduled on the subsystem's timer wheel while holding
+	FTimerWheelHandle HoldTimer;
+
+	/// @brief Timer wheel time (s) at which the hold ends exactly
+	double HoldEndTime = 0.0;
 
-	/// @brief How much to step rotation evaluations in order to keep rotating to 360 degrees and beyond
-	const double RotationStep = 179.9;
-#pragma endregion
 	/// @brief Sequence of movements and rotations via FVector and FRotator
 	TArray<FSequenceStage> Sequence;
 
@@ -129,60 +232,103 @@ private:
 	/// @brief Target Location for the current stage
 	FVector CurrentLocationTarget;
 
-	/// @brief Target Rotation for the current stage
-	FQuat CurrentRotationTarget;
-
-	/// @brief Current amount of rotation applied in the current stage
-	FVector RotationRemaining = FVector::Zero();
-
 	/// @brief Target Location for the current stage
 	FVector PreviousLocationTarget;
 
-	/// @brief Target Rotation for the current stage
-	FQuat PreviousRotationTarget;
+	/// @brief Rotation at the start of the current stage, as travelled forward
+	FQuat StageStartRotation = FQuat::Identity;
+
+	/// @brief Angle (radians) rotated from StageStartRotation about the current stage's baked axis
+	/// @remark Counts up to the stage's baked angle going forward and back down to zero reversing
+	double StageAngle = 0.0;
+
+	/// @brief Subsystem this mover is registered with
+	UTriggerSubsystem* TriggerSubsystem = nullptr;
+
+	/// @brief Distance travelled along a curved stage path in the current direction
+	double StageDistance = 0.0;
+
+	/// @brief Time spent in the current stage in the current direction
+	float StageElapsed = 0.0;
 
 #pragma endregion
 #pragma endregion
 
+	/// @brief Location the mover animates, in world space or relative to the attach parent
+	FVector GetMoverLocation() const;
+
+	/// @brief Rotation the mover animates, in world space or relative to the attach parent
+	FQuat GetMoverRotation() const;
+
+	/// @brief Sets the location the mover animates, in world space or relative to the attach parent
+	void SetMoverLocation(const FVector& Location, ETeleportType Teleport = ETeleportType::None);
+
+	/// @brief Sets the rotation the mover animates, in world space or relative to the attach parent
+	void SetMoverRotation(const FQuat& Rotation);
+
 	/// @brief Loop the movement and rotation, flipping the trigger/reverse values
 	void Loop();
 
+	/// @brief Puts the mover to sleep until the hold time has passed
+	/// @param HoldTime Time (s) to hold
+	/// @return Whether or not the mover is holding
+	bool StartHold(float HoldTime);
+
+	/// @brief Cancels any hold in progress
+	void CancelHold();
+
+	/// @brief Time (s) to hold on arriving at the end of the current stage in the direction of travel
+	float GetArrivalHoldTime(bool bReverse) const;
+
+	/// @brief Queues a lifecycle event for end of frame delivery
+	/// @param Event Event raised
+	void QueueMoverEvent(EMoverEvent Event);
+
+	/// @brief Builds the curved path and easing lookup tables for stages added from the first index onward
+	/// @param FirstIndex First stage to build
+	void BakeStages(int32 FirstIndex);
+
+	/// @brief Flips the distance and time travelled in the current stage when the direction changes mid-stage
+	void FlipStageProgress();
+
+	/// @brief Turns the mover around within the current stage, heading back to where the stage started
+	void FlipDirection();
+
+	/// @brief Normalized time through the stage at the middle of this frame
+	/// @param Stage Location or rotation stage
+	/// @param bReverse Whether or not we are reversing, which determines the stage duration
+	/// @param DeltaTime Time difference between frame changes
+	float GetStageAlpha(const FStage &Stage, bool bReverse, const float DeltaTime) const;
+
 	/// @brief Perform the movement actions
+	template<EStageEasing Easing>
 	void Move(const float DeltaTime, const FVector &CurrentLocation, const FStageLocation &CurrentStage, bool bReverse);
 
 	/// @brief Perform the rotation action
-	void Rotate(const float DeltaTime, const FRotator &CurrentRotation, const FStageRotation &CurrentStage, bool bReverse);
+	template<EStageEasing Easing>
+	void Rotate(const float DeltaTime, const FStageRotation &CurrentStage, bool bReverse);
+
+	/// @brief Whether or not the current stage's rotation has reached its end in the direction of travel
+	bool IsRotationDone(bool bReverse) const;
+
+	/// @brief Whether or not the current stage's location has reached its end
+	/// @remark Curved stages are measured along the path, since a closed path (loop, conveyor) ends where it starts
+	bool IsLocationDone(const FVector& CurrentLocation, const FStageLocation& StageLocation) const;
 
 	/// @brief Performs the movement and rotation based on the sequence
 	/// @param Reverse Whether or not to reverse the sequence
+	template<EStageEasing Easing>
 	void MoveAndRotate(const float DeltaTime, bool Reverse = false);
 
 	/// @brief Update the current sequence stage and completed stage tracking
 	/// @param CurrentLocation Current Location of the actor
 	/// @param CurrentRotation Current Rotation of the actor
 	/// @param bReverse Whether or not we are reversing which determines movement index update
-	void UpdateStages(const FVector& CurrentLocation, const FRotator& CurrentRotation, bool bReverse = false);
+	void UpdateStages(const FVector& CurrentLocation, const FQuat& CurrentRotation, bool bReverse = false);
 
 	/// @brief Updates the stage targets for Location and Rotation
 	/// @param CurrentLocation Current Location of the actor
 	/// @param CurrentRotation Current Rotation of the actor
 	/// @param Direction Direction to traverse stages represented as 1 or -1
-	void SetStageTargets(const FVector& CurrentLocation, const FRotator& CurrentRotation, const int32 Direction);
-
-	/// @brief Tracks the force supplied to the rotation, measured in 180 degree intervals
-	/// @param force Yaw, Pitch, or Roll of the force to track
-	/// @return The remaining force target for the supplied yaw, pitch, or roll
-	float TrackRotationForce(const double TrackedForce, const int32 StepInterval, const double Tolerance);
-
-	/// @brief Tracks the current rotation by intervals of 180 degrees and updates the rotation target using FVector as a value container
-	/// @param CurrentRotation Current Rotation of the actor
-	/// @param StepInterval Interval to split up the rotation steps into (typically 180)
-	/// @param Tolerance Amount of tolerance to allow for considering a rotation pretty much at zero
-	/// @return Returns the next step as a rotation
-	FQuat TrackRotationStep(const FVector& CurrentRotation, const int32 StepInterval, const double Tolerance);
-
-	/// @brief Adjusts the remaining rotation to keep it clamped to positive and adjust to zero based on rotation tolerance
-	/// @param ReductionAmount How much the current rotation remaining will be adjusted by
-	/// @param Tolerance Amount of degree variance when considering a rotation is effectively zero
-	void AdjustRemainingRotation(const FVector &ReductionAmount);
+	void SetStageTargets(const FVector& CurrentLocation, const FQuat& CurrentRotation, const int32 Direction);
 };
\ No newline at end of file
@@ -1,5 +1,117 @@
 #include "Gun.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "Components/DecalComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Materials/Material.h"
+#include "HAL/IConsoleManager.h"
+#include "ComponentStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Gun PullTrigger"), STAT_GunPullTrigger, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Gun Fire"), STAT_GunFire, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Gun ResolveHit"), STAT_GunResolveHit, STATGROUP_Components);
+DECLARE_CYCLE_STAT(TEXT("Gun FlushImpacts"), STAT_GunFlushImpacts, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gun Impacts"), STAT_GunImpacts, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gun Impacts Coalesced"), STAT_GunImpactsCoalesced, STATGROUP_Components);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gun Decals Reused"), STAT_GunDecalsReused, STATGROUP_Components);
+
+namespace Gun
+{
+	static TAutoConsoleVariable<float> CVarHitBudgetUs(
+		TEXT("gun.HitBudgetUs"),
+		5.0,
+		TEXT("Budget (us) for resolving a single shot's hit, reported against by gun.BenchmarkHits."));
+
+	/// @brief Resolves synthetic hits on a field of targets with a spread of surface types
+	/// @remark Hits are built rather than traced so only the resolution after the trace is measured. Responses
+	///	have decals but no effects or sounds, so the effect events are counted rather than played.
+	static FAutoConsoleCommandWithWorldAndArgs BenchmarkHitsCommand(
+		TEXT("gun.BenchmarkHits"),
+		TEXT("Resolves [Shots = 100000] synthetic hits on [Targets = 64] targets at [ShotsPerFrame = 10], reporting the cost per shot against gun.HitBudgetUs."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (World == nullptr || !World->HasBegunPlay())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("gun.BenchmarkHits needs a world that has begun play"));
+				return;
+			}
+
+			const int32 Shots = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+			const int32 NumTargets = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 64;
+			const int32 ShotsPerFrame = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 10;
+			constexpr int32 NumSurfaces = 8;
+
+			AGun* Gun = World->SpawnActor<AGun>();
+			AActor* Field = World->SpawnActor<AActor>();
+
+			// Half of the surfaces have their own response, the rest fall back to the default
+			UMaterialInterface* DecalMaterial = UMaterial::GetDefaultMaterial(MD_DeferredDecal);
+			TArray<UPhysicalMaterial*> Surfaces;
+			TArray<FImpactResponse> Responses;
+			for (int32 Surface = 0; Surface < NumSurfaces; Surface++)
+			{
+				UPhysicalMaterial* PhysicalMaterial = NewObject<UPhysicalMaterial>(Field);
+				PhysicalMaterial->SurfaceType = EPhysicalSurface(SurfaceType1 + Surface);
+				Surfaces.Add(PhysicalMaterial);
+
+				if (Surface % 2 == 0)
+				{
+					FImpactResponse& Response = Responses.AddDefaulted_GetRef();
+					Response.SurfaceType = PhysicalMaterial->SurfaceType;
+					Response.DecalMaterial = DecalMaterial;
+				}
+			}
+
+			FImpactResponse Default;
+			Default.DecalMaterial = DecalMaterial;
+			Gun->SetImpactResponses(Responses, Default);
+
+			// Targets on a wall in front of the gun, each with one of the surfaces
+			TArray<UBoxComponent*> Targets;
+			for (int32 Target = 0; Target < NumTargets; Target++)
+			{
+				UBoxComponent* Box = NewObject<UBoxComponent>(Field);
+				Box->SetWorldLocation(FVector(1000.0, (Target % 8) * 150.0, (Target / 8) * 150.0));
+				Targets.Add(Box);
+			}
+
+			FRandomStream Random(0);
+			TArray<FHitResult> Hits;
+			Hits.Reserve(Shots);
+			for (int32 Shot = 0; Shot < Shots; Shot++)
+			{
+				const int32 Target = Random.RandRange(0, NumTargets - 1);
+				const FVector Location = Targets[Target]->GetComponentLocation() + FVector(-32.0, Random.FRandRange(-32.0, 32.0), Random.FRandRange(-32.0, 32.0));
+
+				FHitResult& Hit = Hits.Emplace_GetRef(Field, Targets[Target], Location, FVector(-1.0, 0.0, 0.0));
+				Hit.PhysMaterial = Surfaces[Target % NumSurfaces];
+			}
+
+			int32 EffectEvents = 0;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Shot = 0; Shot < Shots; Shot++)
+			{
+				Gun->ResolveHit(Hits[Shot]);
+				if (Shot % ShotsPerFrame == ShotsPerFrame - 1)
+				{
+					EffectEvents += Gun->FlushImpacts();
+				}
+			}
+			EffectEvents += Gun->FlushImpacts();
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+			Gun->Destroy();
+			Field->Destroy();
+
+			const double ShotUs = Seconds * 1e6 / Shots;
+			const float BudgetUs = CVarHitBudgetUs.GetValueOnGameThread();
+			UE_LOG(LogTemp, Log, TEXT("gun.BenchmarkHits: %i shots in %.3fms, %.3fus/shot (budget %.2fus, %s), %i effect events (%.1f shots/event)"),
+				Shots, Seconds * 1000.0, ShotUs, BudgetUs, ShotUs <= BudgetUs ? TEXT("within") : TEXT("over"),
+				EffectEvents, EffectEvents > 0 ? double(Shots) / EffectEvents : 0.0);
+		}));
+}
 
 // Sets default values
 AGun::AGun()
@@ -13,22 +125,60 @@ AGun::AGun()
 	// Attach mesh to root component
 	Mesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Mesh"));
 	Mesh->SetupAttachment(Root);
+
+	BuildSurfaceResponses();
 }
 
 // Called when the game starts or when spawned
 void AGun::BeginPlay()
 {
 	Super::BeginPlay();
+
+	BuildSurfaceResponses();
+}
+
+// Called when the game ends or when destroyed
+void AGun::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (UDecalComponent* Decal : Decals)
+	{
+		if (IsValid(Decal))
+		{
+			Decal->DestroyComponent();
+		}
+	}
+	Decals.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
 void AGun::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	// Fire every shot due this frame, so the rate holds when frames are longer than a shot
+	// FireRate is only clamped in the editor, so a rate set from code may not allow any shots
+	FireCooldown -= DeltaTime;
+	while (bTriggerHeld && FireRate > 0.0 && FireCooldown <= 0.0)
+	{
+		Fire();
+		FireCooldown += 1.0 / FireRate;
+	}
+	if (!bTriggerHeld)
+	{
+		FireCooldown = FMath::Max(FireCooldown, 0.0f);
+	}
+
+	FlushImpacts();
 }
 
 void AGun::PullTrigger()
 {
+	SCOPE_CYCLE_COUNTER(STAT_GunPullTrigger);
+
+	bTriggerHeld = true;
+
 	if (AttachedMuzzleFlash)
 	{
 		if (AttachedMuzzleFlash->IsActive())
@@ -54,9 +204,178 @@ void AGun::PullTrigger()
 
 void AGun::ReleaseTrigger()
 {
+	bTriggerHeld = false;
+
 	if (AttachedMuzzleFlash)
 	{
 		AttachedMuzzleFlash->Deactivate();
 	}
 }
- 
\ No newline at end of file
+ 
+
+void AGun::Fire()
+{
+	SCOPE_CYCLE_COUNTER(STAT_GunFire);
+
+	// Guns are owned by the pawn carrying them, falling back to the instigator or the actor they are attached to
+	APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	if (OwnerPawn == nullptr)
+	{
+		OwnerPawn = GetInstigator() ? GetInstigator() : Cast<APawn>(GetAttachParentActor());
+	}
+	AController* Controller = OwnerPawn ? OwnerPawn->GetController() : nullptr;
+	if (Controller == nullptr)
+	{
+		return;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GunFire), false, this);
+	Params.AddIgnoredActor(OwnerPawn);
+	Params.bReturnPhysicalMaterial = true;
+
+	FHitResult Hit;
+	if (GetWorld()->LineTraceSingleByChannel(Hit, ViewLocation, ViewLocation + ViewRotation.Vector() * MaxRange, TraceChannel, Params))
+	{
+		ResolveHit(Hit);
+	}
+}
+
+void AGun::ResolveHit(const FHitResult& Hit)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GunResolveHit);
+	INC_DWORD_STAT(STAT_GunImpacts);
+
+	const EPhysicalSurface SurfaceType = UPhysicalMaterial::DetermineSurfaceType(Hit.PhysMaterial.Get());
+	const FImpactResponse& Response = GetImpactResponse(SurfaceType);
+	const UPrimitiveComponent* Component = Hit.GetComponent();
+
+	PlaceDecal(Response, Hit);
+
+	// Only a handful of surfaces are hit in a frame, so a linear search beats hashing
+	for (const FPendingImpact& Pending : PendingImpacts)
+	{
+		if (Pending.Component == Component && Pending.SurfaceType == SurfaceType)
+		{
+			INC_DWORD_STAT(STAT_GunImpactsCoalesced);
+			return;
+		}
+	}
+
+	PendingImpacts.Add({ Component, SurfaceType, Hit.ImpactPoint, Hit.ImpactNormal.Rotation() });
+}
+
+int32 AGun::FlushImpacts()
+{
+	const int32 NumEvents = PendingImpacts.Num();
+	if (NumEvents == 0)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_GunFlushImpacts);
+
+	for (const FPendingImpact& Pending : PendingImpacts)
+	{
+		const FImpactResponse& Response = GetImpactResponse(Pending.SurfaceType);
+		if (Response.Effect)
+		{
+			UGameplayStatics::SpawnEmitterAtLocation(this, Response.Effect, Pending.Location, Pending.Rotation);
+		}
+		if (Response.Sound)
+		{
+			UGameplayStatics::PlaySoundAtLocation(this, Response.Sound, Pending.Location);
+		}
+	}
+	PendingImpacts.Reset();
+
+	CSV_CUSTOM_STAT(Components, GunImpactEvents, NumEvents, ECsvCustomStatOp::Accumulate);
+	return NumEvents;
+}
+
+void AGun::SetImpactResponses(const TArray<FImpactResponse>& Responses, const FImpactResponse& Default)
+{
+	ImpactResponses = Responses;
+	DefaultImpactResponse = Default;
+	BuildSurfaceResponses();
+}
+
+void AGun::BuildSurfaceResponses()
+{
+	for (int32& Response : SurfaceResponses)
+	{
+		Response = INDEX_NONE;
+	}
+
+	for (int32 Index = 0; Index < ImpactResponses.Num(); Index++)
+	{
+		int32& Response = SurfaceResponses[ImpactResponses[Index].SurfaceType];
+		if (Response == INDEX_NONE)
+		{
+			Response = Index;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s has more than one impact response for surface %i, only the first is used"), *GetActorNameOrLabel(), int32(ImpactResponses[Index].SurfaceType));
+		}
+	}
+}
+
+const FImpactResponse& AGun::GetImpactResponse(EPhysicalSurface SurfaceType) const
+{
+	const int32 Index = SurfaceResponses[SurfaceType];
+	return Index == INDEX_NONE ? DefaultImpactResponse : ImpactResponses[Index];
+}
+
+void AGun::PlaceDecal(const FImpactResponse& Response, const FHitResult& Hit)
+{
+	if (Response.DecalMaterial == nullptr)
+	{
+		return;
+	}
+
+	FRotator Rotation = Hit.ImpactNormal.Rotation();
+	Rotation.Roll = FMath::FRandRange(-180.0, 180.0);
+
+	// Reuse the oldest decal once the pool is full, replacing any that were destroyed with the level
+	UDecalComponent* Decal = Decals.Num() >= MaxDecals ? Decals[NextDecal] : nullptr;
+	if (!IsValid(Decal))
+	{
+		Decal = UGameplayStatics::SpawnDecalAtLocation(this, Response.DecalMaterial, Response.DecalSize, Hit.ImpactPoint, Rotation, 0.0);
+		if (Decal == nullptr)
+		{
+			return;
+		}
+
+		if (Decals.Num() < MaxDecals)
+		{
+			LLM_SCOPE_BYTAG(Components);
+			const SIZE_T AllocatedSize = Decals.GetAllocatedSize();
+			Decals.Add(Decal);
+			TRACK_COMPONENT_ALLOCATION(Decals, AllocatedSize);
+			return;
+		}
+
+		Decals[NextDecal] = Decal;
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_GunDecalsReused);
+
+		if (Decal->GetDecalMaterial() != Response.DecalMaterial)
+		{
+			Decal->SetDecalMaterial(Response.DecalMaterial);
+		}
+		if (Decal->DecalSize != Response.DecalSize)
+		{
+			Decal->DecalSize = Response.DecalSize;
+			Decal->MarkRenderStateDirty();
+		}
+		Decal->SetWorldLocationAndRotation(Hit.ImpactPoint, Rotation);
+	}
+
+	NextDecal = (NextDecal + 1) % MaxDecals;
+}
@@ -6,6 +6,43 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Gun.generated.h"
 
+class UDecalComponent;
+class UMaterialInterface;
+class USoundBase;
+
+/// @brief Effects played where a shot hits a surface type
+USTRUCT(BlueprintType)
+struct FImpactResponse
+{
+	GENERATED_BODY()
+
+	/// @brief Surface type of the physical material this response is played for
+	UPROPERTY(EditAnywhere)
+	TEnumAsByte<EPhysicalSurface> SurfaceType = SurfaceType_Default;
+
+	UPROPERTY(EditAnywhere)
+	UParticleSystem* Effect = nullptr;
+
+	UPROPERTY(EditAnywhere)
+	USoundBase* Sound = nullptr;
+
+	UPROPERTY(EditAnywhere)
+	UMaterialInterface* DecalMaterial = nullptr;
+
+	UPROPERTY(EditAnywhere)
+	FVector DecalSize = FVector(4.0, 8.0, 8.0);
+};
+
+/*
+	Gun
+
+	While the trigger is held the gun fires FireRate shots per second, tracing from the owner's view point.
+	Hits are resolved in a fixed, small amount of work so high rate weapons stay cheap:
+		- the impact response is read from a flat table indexed by the hit's surface type
+		- impacts on the same component and surface within a frame share one effect and sound, played on Tick
+		- decals come from a pool of MaxDecals components, the oldest reused once it is full
+	`gun.BenchmarkHits` measures the per-shot cost of resolving hits against gun.HitBudgetUs.
+*/
 UCLASS()
 class SIMPLESHOOTER_API AGun : public AActor
 {
@@ -24,10 +61,29 @@ public:
 	/// @brief Trigger release
 	void ReleaseTrigger();
 
+	/// @brief Fires a single shot, tracing from the owner's view point
+	void Fire();
+
+	/// @brief Places the decal and queues the effect for a hit, coalescing with other impacts on the surface this frame
+	/// @param Hit Blocking hit of a shot. The trace should return the physical material.
+	void ResolveHit(const FHitResult& Hit);
+
+	/// @brief Plays the effects queued since the last flush, one per surface hit
+	/// @return Number of effect events played
+	int32 FlushImpacts();
+
+	/// @brief Replaces the impact responses and rebuilds the surface lookup table
+	/// @param Responses Responses by surface type. Later entries for the same surface are ignored.
+	/// @param Default Response for surfaces without one
+	void SetImpactResponses(const TArray<FImpactResponse>& Responses, const FImpactResponse& Default);
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	// Called when the game ends or when destroyed
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 	UPROPERTY(VisibleAnywhere)
 	USceneComponent* Root;
@@ -42,4 +98,63 @@ private:
 	FName MuzzleFlashSocket = NAME_None;
 
 	UParticleSystemComponent* AttachedMuzzleFlash;
+
+	/// @brief Shots per second while the trigger is held
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = "0.1"))
+	float FireRate = 10.0;
+
+	/// @brief Length of a shot's trace
+	UPROPERTY(EditAnywhere)
+	float MaxRange = 10000.0;
+
+	UPROPERTY(EditAnywhere)
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/// @brief Responses to hits, by surface type
+	UPROPERTY(EditAnywhere)
+	TArray<FImpactResponse> ImpactResponses;
+
+	/// @brief Response to hits on surfaces without one
+	UPROPERTY(EditAnywhere)
+	FImpactResponse DefaultImpactResponse;
+
+	/// @brief Most decals this gun keeps in the world
+	UPROPERTY(EditAnywhere, Meta = (ClampMin = "1"))
+	int32 MaxDecals = 32;
+
+	/// @brief Whether or not the trigger is held
+	bool bTriggerHeld = false;
+
+	/// @brief Time until the next shot can be fired
+	float FireCooldown = 0.0;
+
+	/// @brief Index into ImpactResponses for each surface type, or INDEX_NONE for the default response
+	int32 SurfaceResponses[SurfaceType_Max];
+
+	/// @brief Impacts waiting for their effect, one per surface hit this frame
+	struct FPendingImpact
+	{
+		/// @brief Component hit, only compared
+		const UPrimitiveComponent* Component = nullptr;
+		EPhysicalSurface SurfaceType = SurfaceType_Default;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+	};
+	TArray<FPendingImpact> PendingImpacts;
+
+	/// @brief Pooled decals, reused oldest first once MaxDecals are placed
+	UPROPERTY()
+	TArray<UDecalComponent*> Decals;
+
+	/// @brief Next decal to reuse
+	int32 NextDecal = 0;
+
+	/// @brief Rebuilds SurfaceResponses from ImpactResponses
+	void BuildSurfaceResponses();
+
+	/// @brief Response played for a surface type
+	const FImpactResponse& GetImpactResponse(EPhysicalSurface SurfaceType) const;
+
+	/// @brief Places a decal for a hit from the pool
+	void PlaceDecal(const FImpactResponse& Response, const FHitResult& Hit);
 };